@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef e5c2a9f4_71d3_4b8e_8f06_3a9d4c21b7e0
+#define e5c2a9f4_71d3_4b8e_8f06_3a9d4c21b7e0
+
+/*
+ * base64.h
+ * Base64 encoding and decoding (RFC 4648), standard and url-safe alphabets.
+ */
+
+#include "ctoolbox.h"
+
+
+/* Flags */
+typedef enum {
+	BASE64_STANDARD = 0x00,  /* "+/" alphabet */
+	BASE64_URLSAFE  = 0x01,  /* "-_" alphabet */
+	BASE64_NOPAD    = 0x02   /* don't emit the "=" padding when encoding */
+} eBASE64Flags;
+
+
+/* Error codes */
+typedef enum {
+	BASE64_OK     = 0,
+	BASE64_EINPUT = 1,  /* invalid character, padding or trailing bits */
+	BASE64_ESIZE  = 2   /* truncated input */
+} eBASE64Error;
+
+
+/*
+ * Encoder/decoder state for chunked input. */
+struct TBase64 {
+	uintxx flags;
+
+	/* decoder: set once the padding has been consumed */
+	uintxx done;
+
+	/* pending bytes (encoder) or characters (decoder) */
+	uintxx total;
+	uint8  pending[4];
+};
+
+typedef struct TBase64 TBase64;
+
+
+/*
+ * Returns the exact size of the encoded output for size bytes of input. */
+CTOOLBOX_API
+uintxx ctb_base64encodedsize(uintxx size, uintxx flags);
+
+/*
+ * Returns the exact size of the decoded output of a (valid) encoded
+ * string, the padding is optional. */
+CTOOLBOX_API
+uintxx ctb_base64decodedsize(const uint8* src, uintxx size);
+
+
+/*
+ * Encodes size bytes, the destination must hold ctb_base64encodedsize
+ * bytes (no terminating zero is written). Returns the number of characters
+ * written. */
+CTOOLBOX_API
+uintxx ctb_base64encode(const uint8* src, uintxx size, uint8* dst, uintxx flags);
+
+/*
+ * Decodes size characters, the padding is optional and no white-space is
+ * allowed. The decoding is strict, the unused low bits of the last
+ * character must be zero ("QQ==" is accepted but "QR==" is not). If total
+ * is not NULL, stores the number of bytes written. */
+CTOOLBOX_API
+eintxx ctb_base64decode(const uint8* src, uintxx size, uint8* dst, uintxx flags, uintxx* total);
+
+
+/*
+ * Streaming interface. The same state is used to encode or to decode. */
+CTOOLBOX_API
+void ctb_base64init(TBase64* state, uintxx flags);
+
+/*
+ * Encodes a chunk, at most ((state->total + size) / 3) * 4 characters are
+ * written. Returns the number of characters written. */
+CTOOLBOX_API
+uintxx ctb_base64encodeupdate(TBase64* state, const uint8* src, uintxx size, uint8* dst);
+
+/*
+ * Flushes the pending bytes, at most 4 characters are written. */
+CTOOLBOX_API
+uintxx ctb_base64encodefinal(TBase64* state, uint8* dst);
+
+/*
+ * Decodes a chunk, at most ((state->total + size) / 4) * 3 bytes are written.
+ * If total is not NULL, stores the number of bytes written. */
+CTOOLBOX_API
+eintxx ctb_base64decodeupdate(TBase64* state, const uint8* src, uintxx size, uint8* dst, uintxx* total);
+
+/*
+ * Flushes the pending characters, at most 2 bytes are written. */
+CTOOLBOX_API
+eintxx ctb_base64decodefinal(TBase64* state, uint8* dst, uintxx* total);
+
+
+#endif
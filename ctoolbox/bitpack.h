@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef f70bb294_9cde_42e3_b812_9efc74ebceb5
+#define f70bb294_9cde_42e3_b812_9efc74ebceb5
+
+/*
+ * bitpack.h
+ * Block based compression of 32 bit integers: delta coding and bit packing.
+ */
+
+#include "ctoolbox.h"
+
+
+/* Number of integers in a block */
+#define BITPACK_BLOCKSIZE 128
+
+/* Largest size of an encoded block (in 32 bit words) */
+#define BITPACK_MAXBLOCKSIZE (3 + BITPACK_BLOCKSIZE)
+
+
+/* Encodings */
+typedef enum {
+	BITPACK_FOR    = 0,  /* offsets from the minimum of the block */
+	BITPACK_DELTA  = 1,  /* differences between consecutive integers */
+	BITPACK_DELTA2 = 2   /* differences of the differences (zigzag mapped) */
+} eBITPACKMode;
+
+
+/* Error codes */
+typedef enum {
+	BITPACK_OK     = 0,
+	BITPACK_EINPUT = 1,  /* invalid block header */
+	BITPACK_ESIZE  = 2   /* truncated input */
+} eBITPACKError;
+
+
+/*
+ * The integers are split in blocks of 128. Each block starts with a header
+ * (the bit width and the encoding, then one or two reference values) and is
+ * followed by its 128 integers packed with the smallest width that fits
+ * them, the last block is padded. Blocks can be decoded on their own.
+ *
+ * BITPACK_DELTA suits sorted integers (row IDs) and BITPACK_DELTA2 integers
+ * at nearly regular intervals (timestamps). The differences wrap around, so
+ * any input can be encoded with any of the modes. */
+
+/*
+ * Returns the largest size (in 32 bit words) of count encoded integers. */
+CTB_INLINE
+uintxx ctb_bitpackmaxsize(uintxx count);
+
+/*
+ * Returns the number of bits needed to store the largest of count integers
+ * (zero if they are all zero). */
+CTOOLBOX_API
+uintxx ctb_bitpackwidth(const uint32* src, uintxx count);
+
+
+/*
+ * Packs 128 integers of bits bits (0 to 32) in 4 * bits words, the integers
+ * must fit in the given width. The integers are interleaved in four lanes so
+ * they can be processed four at a time. Returns the number of words written. */
+CTOOLBOX_API
+uintxx ctb_bitpack128(const uint32* src, uintxx bits, uint32* dst);
+
+/*
+ * Unpacks 128 integers of bits bits (0 to 32). Returns the number of words
+ * read. */
+CTOOLBOX_API
+uintxx ctb_bitunpack128(const uint32* src, uintxx bits, uint32* dst);
+
+
+/*
+ * Encodes count integers, dst must hold ctb_bitpackmaxsize(count) words.
+ * Returns the number of words written. */
+CTOOLBOX_API
+uintxx ctb_bitpackencode(const uint32* src, uintxx count, uintxx mode, uint32* dst);
+
+/*
+ * Decodes count integers from at most size words. If total is not NULL,
+ * stores the number of words read. */
+CTOOLBOX_API
+eintxx ctb_bitpackdecode(const uint32* src, uintxx size, uint32* dst, uintxx count, uintxx* total);
+
+
+/*
+ * Random access. Stores the offset (in words) of each of the blocks of count
+ * integers, offsets must hold (count + 127) / 128 elements. */
+CTOOLBOX_API
+eintxx ctb_bitpackindex(const uint32* src, uintxx size, uintxx count, uintxx* offsets);
+
+/*
+ * Decodes the block at src, dst must hold 128 integers (only the first
+ * count % 128 are meaningful for a partial last block). If total is not
+ * NULL, stores the number of words read. */
+CTOOLBOX_API
+eintxx ctb_bitpackdecodeblock(const uint32* src, uintxx size, uint32* dst, uintxx* total);
+
+
+/*
+ * Inlines */
+
+CTB_INLINE uintxx
+ctb_bitpackmaxsize(uintxx count)
+{
+	return ((count + BITPACK_BLOCKSIZE - 1) / BITPACK_BLOCKSIZE) * BITPACK_MAXBLOCKSIZE;
+}
+
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef d3a7c1e2_5b64_4f0e_9c8a_6e2f17b0a945
+#define d3a7c1e2_5b64_4f0e_9c8a_6e2f17b0a945
+
+/*
+ * cpuinfo.h
+ * Runtime detection of processor features.
+ */
+
+#include "ctoolbox.h"
+
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define CTB_X86
+#endif
+
+
+/*
+ * SIMD kernels are compiled with per function target attributes so the rest
+ * of the library can be built for the baseline instruction set; the kernel
+ * is selected at runtime using ctb_cpufeatures. */
+#if defined(CTB_X86) && !defined(CTB_CFG_NOSIMD)
+	#if defined(__GNUC__)
+		#define CTB_X86SIMD
+		#define CTB_TARGET(T) __attribute__((target(T)))
+	#else
+		#if defined(_MSC_VER)
+			#define CTB_X86SIMD
+			#define CTB_TARGET(T)
+		#endif
+	#endif
+#endif
+
+
+/* Processor features */
+#define CTB_CPU_SSE2  0x0001
+#define CTB_CPU_SSSE3 0x0002
+#define CTB_CPU_SSE41 0x0004
+#define CTB_CPU_AVX2  0x0008
+#define CTB_CPU_BMI2  0x0010
+
+
+/*
+ * Returns the set of features (CTB_CPU_*) supported by the processor and the
+ * operating system. The detection is done once, the result is cached. */
+CTOOLBOX_API
+uintxx ctb_cpufeatures(void);
+
+
+#endif
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef e90ac9f8_bb4e_435c_85de_005a12f147df
+#define e90ac9f8_bb4e_435c_85de_005a12f147df
+
+/*
+ * fastdiv.h
+ * Unsigned division by invariant integers using multiplication.
+ */
+
+#include "ctoolbox.h"
+#include "uint128.h"
+
+
+/*
+ * Precomputed reciprocal of a divisor. The low bits of more hold the final
+ * shift, FASTDIV_ADD is set when the magic number needs 33 (or 65) bits
+ * (always set by the branchfree generators). */
+struct TDivU32 {
+	uint32 magic;
+	uint32 more;
+	uint32 divisor;
+};
+
+struct TDivU64 {
+	uint64 magic;
+	uint32 more;
+	uint64 divisor;
+};
+
+typedef struct TDivU32 TDivU32;
+typedef struct TDivU64 TDivU64;
+
+
+#define FASTDIV_ADD 0x40
+
+
+/*
+ * Computes the reciprocal of d (must not be zero). */
+CTOOLBOX_API
+TDivU32 ctb_divu32gen(uint32 d);
+
+CTOOLBOX_API
+TDivU64 ctb_divu64gen(uint64 d);
+
+/*
+ * Computes the reciprocal of d for the branchfree variants (d must be
+ * greater than 1). */
+CTOOLBOX_API
+TDivU32 ctb_divu32bfgen(uint32 d);
+
+CTOOLBOX_API
+TDivU64 ctb_divu64bfgen(uint64 d);
+
+
+/*
+ * Returns n / d and n % d, d can be computed with any of the generators. */
+CTB_INLINE
+uint32 ctb_divu32(uint32 n, const TDivU32* d);
+
+CTB_INLINE
+uint32 ctb_modu32(uint32 n, const TDivU32* d);
+
+CTB_INLINE
+uint64 ctb_divu64(uint64 n, const TDivU64* d);
+
+CTB_INLINE
+uint64 ctb_modu64(uint64 n, const TDivU64* d);
+
+/*
+ * Branchfree variants, d must be computed with ctb_divuXXbfgen. */
+CTB_INLINE
+uint32 ctb_divu32bf(uint32 n, const TDivU32* d);
+
+CTB_INLINE
+uint32 ctb_modu32bf(uint32 n, const TDivU32* d);
+
+CTB_INLINE
+uint64 ctb_divu64bf(uint64 n, const TDivU64* d);
+
+CTB_INLINE
+uint64 ctb_modu64bf(uint64 n, const TDivU64* d);
+
+
+/*
+ * Divides (or takes the modulo of) size numbers, src and dst may be the
+ * same buffer. Accepts the reciprocals from both generators. */
+CTOOLBOX_API
+void ctb_divu32batch(const uint32* src, uintxx size, uint32* dst, const TDivU32* d);
+
+CTOOLBOX_API
+void ctb_modu32batch(const uint32* src, uintxx size, uint32* dst, const TDivU32* d);
+
+CTOOLBOX_API
+void ctb_divu64batch(const uint64* src, uintxx size, uint64* dst, const TDivU64* d);
+
+CTOOLBOX_API
+void ctb_modu64batch(const uint64* src, uintxx size, uint64* dst, const TDivU64* d);
+
+
+/*
+ * Inlines */
+
+CTB_INLINE uint32
+ctb_divu32(uint32 n, const TDivU32* d)
+{
+	uint32 q;
+
+	if (d->more & FASTDIV_ADD) {
+		q = (uint32) (((uint64) d->magic * n) >> 32);
+		return (((n - q) >> 1) + q) >> (d->more & 0x1f);
+	}
+
+	if (d->magic == 0) {
+		return n >> d->more;
+	}
+	q = (uint32) (((uint64) d->magic * n) >> 32);
+	return q >> d->more;
+}
+
+CTB_INLINE uint32
+ctb_modu32(uint32 n, const TDivU32* d)
+{
+	return n - ctb_divu32(n, d) * d->divisor;
+}
+
+CTB_INLINE uint64
+ctb_divu64(uint64 n, const TDivU64* d)
+{
+	uint64 q;
+
+	if (d->more & FASTDIV_ADD) {
+		q = ctb_mul128hi(d->magic, n);
+		return (((n - q) >> 1) + q) >> (d->more & 0x3f);
+	}
+
+	if (d->magic == 0) {
+		return n >> d->more;
+	}
+	q = ctb_mul128hi(d->magic, n);
+	return q >> d->more;
+}
+
+CTB_INLINE uint64
+ctb_modu64(uint64 n, const TDivU64* d)
+{
+	return n - ctb_divu64(n, d) * d->divisor;
+}
+
+CTB_INLINE uint32
+ctb_divu32bf(uint32 n, const TDivU32* d)
+{
+	uint32 q;
+
+	q = (uint32) (((uint64) d->magic * n) >> 32);
+	return (((n - q) >> 1) + q) >> (d->more & 0x1f);
+}
+
+CTB_INLINE uint32
+ctb_modu32bf(uint32 n, const TDivU32* d)
+{
+	return n - ctb_divu32bf(n, d) * d->divisor;
+}
+
+CTB_INLINE uint64
+ctb_divu64bf(uint64 n, const TDivU64* d)
+{
+	uint64 q;
+
+	q = ctb_mul128hi(d->magic, n);
+	return (((n - q) >> 1) + q) >> (d->more & 0x3f);
+}
+
+CTB_INLINE uint64
+ctb_modu64bf(uint64 n, const TDivU64* d)
+{
+	return n - ctb_divu64bf(n, d) * d->divisor;
+}
+
+
+#endif
@@ -19,7 +19,7 @@
 
 /*
  * flt2str.h
- * Float IEEE754 to decimal string conversion.
+ * Float IEEE754 to decimal (or hexadecimal) string conversion.
  */
 
 #include "ctoolbox.h"
@@ -29,20 +29,95 @@
 typedef enum {
 	FLTF_MODEG = 0,  /* same as libc "%.<precision>g" */
 	FLTF_MODEE = 1,  /* same as libc "%.<precision>e" */
-	FLTF_MODED = 2   /* like "%.16e" using all the significant digits */
+	FLTF_MODED = 2,  /* like "%.16e" using all the significant digits */
+	FLTF_MODEF = 3,  /* same as libc "%.<precision>f" */
+	FLTF_MODEJ = 4   /* shortest round trip, like ECMAScript Number toString */
 } eFLTFormatMode;
 
 
+/*
+ * Result of a batch conversion. */
+struct TFltToStrBatchResult {
+	/* number of values written */
+	uintxx count;
+
+	/* number of bytes written (the NUL is not included) */
+	uintxx length;
+};
+
+typedef struct TFltToStrBatchResult TFltToStrBatchResult;
+
+
 /*
  * Convert a float to a string. The precision is the number of digits after
- * the decimal point. */
+ * the decimal point. r must hold 26 bytes (the longest FLTF_MODEJ result,
+ * the other modes take up to 25). */
 CTOOLBOX_API
-uintxx f64tostr(flt64 number, eFLTFormatMode m, uintxx precision, uint8 r[24]);
+uintxx f64tostr(flt64 number, eFLTFormatMode m, uintxx precision, uint8 r[26]);
 
 /*
  * */
 CTOOLBOX_API
 uintxx f32tostr(flt32 number, eFLTFormatMode m, uintxx precision, uint8 r[24]);
 
+/*
+ * Converts a float with any precision, the digits are exact (correctly
+ * rounded, ties to even, like glibc) in the E and F modes. The other modes
+ * are those of f64tostr. At most size bytes (NUL included) are written, if
+ * the result does not fit nothing is written and returns zero.
+ * The other functions accept FLTF_MODEF, the result must fit in their
+ * buffer (26 bytes for f64tostr, 24 for the others).
+ * The J mode ignores the precision and writes what JSON serializers emit for
+ * finite numbers ("1e+21", "0.000001", "123" and "0" for -0), the special
+ * values are "NaN", "Infinity" and "-Infinity". */
+CTOOLBOX_API
+uintxx f64tostrn(flt64 number, eFLTFormatMode m, uintxx precision, uint8* r, uintxx size);
+
+/*
+ * Returns the size (NUL included) f64tostrn needs for the conversion, an
+ * upper bound that exceeds the length of the result by at most five bytes. */
+CTOOLBOX_API
+uintxx f64tostrsize(flt64 number, eFLTFormatMode m, uintxx precision);
+
+/*
+ * Same as above for a half precision (IEEE754 binary16) or a bfloat16 float
+ * given as bits. The shortest representation is that of the 16 bit type, not
+ * that of the value widened to flt32. */
+CTOOLBOX_API
+uintxx f16tostr(uint16 number, eFLTFormatMode m, uintxx precision, uint8 r[24]);
+
+CTOOLBOX_API
+uintxx bf16tostr(uint16 number, eFLTFormatMode m, uintxx precision, uint8 r[24]);
+
+/*
+ * Converts count floats into dst, separated by the NUL terminated string
+ * separator, as f64tostr (f64tostrn in the F mode) would. At most size bytes
+ * are written and the output is NUL terminated, the conversion stops before
+ * the first value that does not fit. If offsets is not NULL, stores the
+ * offset in dst of each value written. */
+CTOOLBOX_API
+TFltToStrBatchResult f64tostrbatch(const flt64* src, uintxx count, eFLTFormatMode m, uintxx precision, const uint8* separator, uint8* dst, uintxx size, uintxx* offsets);
+
+CTOOLBOX_API
+TFltToStrBatchResult f32tostrbatch(const flt32* src, uintxx count, eFLTFormatMode m, uintxx precision, const uint8* separator, uint8* dst, uintxx size, uintxx* offsets);
+
+/*
+ * Same as above for binary16 and bfloat16, src holds the bits. */
+CTOOLBOX_API
+TFltToStrBatchResult f16tostrbatch(const uint16* src, uintxx count, eFLTFormatMode m, uintxx precision, const uint8* separator, uint8* dst, uintxx size, uintxx* offsets);
+
+CTOOLBOX_API
+TFltToStrBatchResult bf16tostrbatch(const uint16* src, uintxx count, eFLTFormatMode m, uintxx precision, const uint8* separator, uint8* dst, uintxx size, uintxx* offsets);
+
+/*
+ * Converts a float to a C99 hexadecimal string ("0x1.8p+3"), like libc "%a".
+ * The conversion is exact and can be read back with hexatoflt64 (or
+ * hexatoflt32). Subnormals are written with a leading "0x0.". */
+CTOOLBOX_API
+uintxx f64tohexstr(flt64 number, uint8 r[32]);
+
+CTOOLBOX_API
+uintxx f32tohexstr(flt32 number, uint8 r[32]);
+
 
 #endif
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef b81f0c6d_2e4a_4c39_a1d7_9f53e08c2b6e
+#define b81f0c6d_2e4a_4c39_a1d7_9f53e08c2b6e
+
+/*
+ * hexcodec.h
+ * Hexadecimal encoding and decoding of byte buffers.
+ */
+
+#include "ctoolbox.h"
+
+
+/* Error codes */
+typedef enum {
+	HEXCODEC_OK     = 0,
+	HEXCODEC_EINPUT = 1,  /* invalid hexadecimal digit */
+	HEXCODEC_ESIZE  = 2   /* odd number of digits */
+} eHEXCODECError;
+
+
+/*
+ * Encodes size bytes as hexadecimal digits (two per byte, high nibble
+ * first). The destination must hold size * 2 bytes, no terminating zero is
+ * written. Returns the number of digits written. */
+CTOOLBOX_API
+uintxx ctb_hexencode(const uint8* src, uintxx size, uint8* dst, intxx uppercase);
+
+/*
+ * Decodes size hexadecimal digits (any case) into size / 2 bytes. If end is
+ * not NULL, stores the pointer to the first digit pair that was not decoded
+ * (the pair holding the invalid digit, or the last digit when size is odd).
+ * On error the bytes of the pairs before it are already written and the
+ * byte of that pair is not. */
+CTOOLBOX_API
+eintxx ctb_hexdecode(const uint8* src, uintxx size, uint8* dst, const uint8** end);
+
+
+#endif
@@ -23,6 +23,15 @@
  */
 
 #include "ctoolbox.h"
+#include "uint128.h"
+
+
+/* Integer format flags */
+typedef enum {
+	INTF_ZEROPAD   = 0x01,  /* pad with zeros after the sign (like "%0<width>") */
+	INTF_LEFTALIGN = 0x02,  /* pad with spaces on the right (like "%-<width>") */
+	INTF_GROUPING  = 0x04   /* group the digits by thousands (like "%'") */
+} eINTFormatFlags;
 
 
 /*
@@ -43,6 +52,37 @@ CTOOLBOX_API
 uintxx i64tostr( int64 number, uint8 r[24]);
 
 
+/*
+ * 128 bit unsigned integer to decimal string. */
+CTOOLBOX_API
+uintxx u128tostr(TUInt128 number, uint8 r[40]);
+
+
+/*
+ * Integer to decimal string padded to width characters (with spaces unless
+ * INTF_ZEROPAD is given) and optionally grouped, the separator 0 means ",".
+ * The destination must hold max(width, 32) + 1 bytes. */
+CTOOLBOX_API
+uintxx u32tostrf(uint32 number, uintxx flags, uintxx width, uint8 separator, uint8* r);
+
+CTOOLBOX_API
+uintxx i32tostrf( int32 number, uintxx flags, uintxx width, uint8 separator, uint8* r);
+
+CTOOLBOX_API
+uintxx u64tostrf(uint64 number, uintxx flags, uintxx width, uint8 separator, uint8* r);
+
+CTOOLBOX_API
+uintxx i64tostrf( int64 number, uintxx flags, uintxx width, uint8 separator, uint8* r);
+
+
+/*
+ * Fixed point decimal to string, the number is the value scaled by 10^scale
+ * (scale from 0 to 19) and is written with exactly scale fractional digits
+ * ("-12.50" for -1250 with scale 2). The destination must hold 24 bytes. */
+CTOOLBOX_API
+uintxx i64toscaledstr(int64 number, uintxx scale, uint8 r[24]);
+
+
 /*
  * Unsigned integer type to hexadecimal string. */
 CTOOLBOX_API
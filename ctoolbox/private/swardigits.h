@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef a4a7c113_be57_484c_99fa_02debe96fd15
+#define a4a7c113_be57_484c_99fa_02debe96fd15
+
+/*
+ * swardigits.h
+ * SWAR decimal digit helpers shared by the string to number conversions,
+ * based on "Fast numeric string to int" by Wojciech Mula and on the
+ * fast_float library by Daniel Lemire.
+ */
+
+#if !defined(CTB_INTERNAL_INCLUDE_GUARD)
+	#error "this file can't be included directly"
+#endif
+
+#include "../ctoolbox.h"
+
+
+#if defined(CTB_FASTUNALIGNED) && CTB_IS_LITTLEENDIAN
+	#define SWARDIGITS
+#endif
+
+#if defined(SWARDIGITS)
+
+/* An 8 byte load that does not cross a page can not fault, the NUL
+ * terminated variants only read past the NUL when the address sanitizer
+ * is not in use */
+#if defined(__SANITIZE_ADDRESS__)
+	#define NOOVERREAD
+#endif
+#if defined(__has_feature)
+	#if __has_feature(address_sanitizer)
+		#define NOOVERREAD
+	#endif
+#endif
+
+#if defined(NOOVERREAD)
+	#define CANREAD8(P) 0
+#else
+	#define MINPAGESIZE 4096
+	#define CANREAD8(P) ((((uintxx) (P)) & (MINPAGESIZE - 1)) <= MINPAGESIZE - 8)
+#endif
+
+static const uint32 powersof10[] = {
+	1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000
+};
+
+/*
+ * Returns zero if the 8 bytes are decimal digits. */
+CTB_INLINE uint64
+nondigits8(uint64 v)
+{
+	uint64 a;
+	uint64 b;
+
+	a = (v & 0xf0f0f0f0f0f0f0f0ull);
+	b = (v + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull;
+	return (a ^ 0x3030303030303030ull) | (b ^ 0x3030303030303030ull);
+}
+
+/*
+ * Index of the first non zero byte. */
+CTB_INLINE uintxx
+firstbyte(uint64 m)
+{
+#if defined(__GNUC__)
+	return (uintxx) __builtin_ctzll(m) >> 3;
+#else
+	uintxx j;
+
+	for (j = 0; (m & 0xff) == 0; j++) {
+		m >>= 8;
+	}
+	return j;
+#endif
+}
+
+/*
+ * Converts 8 digit values (the first digit in the low byte) using three
+ * multiplications. */
+CTB_INLINE uint32
+convert8(uint64 v)
+{
+	uint64 a;
+	uint64 b;
+
+	v = (v * 10) + (v >> 8);
+	a = (v >> 00) & 0x000000ff000000ffull;
+	b = (v >> 16) & 0x000000ff000000ffull;
+	return (uint32) (((a * (100 + (1000000ull << 32))) + (b * (1 + (10000ull << 32)))) >> 32);
+}
+
+#endif
+
+#endif
@@ -19,7 +19,7 @@
 
 /*
  * str2flt.h
- * String (decimal only) to float IEEE754 conversion.
+ * String (decimal or hexadecimal) to float IEEE754 conversion.
  */
 
 #include "ctoolbox.h"
@@ -33,6 +33,21 @@ typedef enum {
 } eSTR2FLTError;
 
 
+/* Flags for the batch conversion */
+typedef enum {
+	STR2FLT_SKIPSPACE  = 0x01,  /* allow white-space around the numbers */
+	STR2FLT_ALLOWEMPTY = 0x02   /* store empty fields as zero */
+} eSTR2FLTFlags;
+
+
+/* Number types */
+typedef enum {
+	STR2FLT_TINT64  = 0,
+	STR2FLT_TUINT64 = 1,
+	STR2FLT_TFLT64  = 2
+} eSTR2FLTNumberType;
+
+
 /*
  * Result of string to float conversion. */
 struct TToFltResult {
@@ -41,11 +56,52 @@ struct TToFltResult {
 	union TFltValue {
 		flt32 asf32;
 		flt64 asf64;
+
+		/* bits of the IEEE754 binary16 and of the bfloat16 */
+		uint16 asf16;
+		uint16 asbf16;
 	} value;
 };
 
 typedef struct TToFltResult TToFltResult;
 
+/*
+ * Result of a batch conversion. */
+struct TToFltBatchResult {
+	eintxx error;
+
+	/* number of values stored */
+	uintxx count;
+
+	/* on error the offset of the invalid field (or of the number out of
+	 * range), otherwise the number of characters consumed */
+	uintxx position;
+};
+
+typedef struct TToFltBatchResult TToFltBatchResult;
+
+/*
+ * Result of the JSON number conversion. */
+struct TToNumberResult {
+	eintxx error;
+	eintxx type;
+
+	union TNumberValue {
+		int64  asi64;
+		uint64 asu64;
+		flt64  asf64;
+	} value;
+
+	/* the first 19 significant digits, the number of significant digits and
+	 * the exponent of the last digit kept (significand * 10^exponent is the
+	 * number truncated to 19 digits) */
+	uint64 significand;
+	int32  digits;
+	int32  exponent;
+};
+
+typedef struct TToNumberResult TToNumberResult;
+
 
 /*
  * Convert a string to a float. The string must be in decimal format. If end
@@ -59,5 +115,71 @@ TToFltResult str2flt64(const uint8* src, const uint8** end);
 CTOOLBOX_API
 TToFltResult str2flt32(const uint8* src, const uint8** end);
 
+/*
+ * Same as above but the scan stops after total characters, the string does
+ * not need to be NUL terminated. */
+CTOOLBOX_API
+TToFltResult str2flt64n(const uint8* src, intxx total, const uint8** end);
+
+CTOOLBOX_API
+TToFltResult str2flt32n(const uint8* src, intxx total, const uint8** end);
+
+/*
+ * Converts a decimal string to a half precision (IEEE754 binary16) or to a
+ * bfloat16 float, correctly rounded (there is no double rounding through
+ * flt32). The result is returned as bits in asf16 (or asbf16). */
+CTOOLBOX_API
+TToFltResult str2flt16(const uint8* src, const uint8** end);
+
+CTOOLBOX_API
+TToFltResult str2bf16(const uint8* src, const uint8** end);
+
+CTOOLBOX_API
+TToFltResult str2flt16n(const uint8* src, intxx total, const uint8** end);
+
+CTOOLBOX_API
+TToFltResult str2bf16n(const uint8* src, intxx total, const uint8** end);
+
+/*
+ * Converts a C99 hexadecimal float ("0x1.8p+3", the "0x" prefix and the
+ * binary exponent are optional) of at most total characters, also accepts
+ * "inf" and "nan". The result is exact unless there are more significant
+ * digits than the float can hold, then it is rounded to nearest. If end is
+ * not NULL, stores the pointer to the character that stopped the scan. */
+CTOOLBOX_API
+TToFltResult hexatoflt64(const uint8* src, intxx total, const uint8** end);
+
+CTOOLBOX_API
+TToFltResult hexatoflt32(const uint8* src, intxx total, const uint8** end);
+
+/*
+ * Converts up to maxcount floats of at most total characters separated by
+ * any of the characters in delimiters (a NUL terminated string). A delimiter
+ * is always followed by a field, so "1,2," holds three. Stops at the first
+ * invalid (or out of range) field, the values before it are stored. */
+CTOOLBOX_API
+TToFltBatchResult str2flt64batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, flt64* dst, uintxx maxcount);
+
+CTOOLBOX_API
+TToFltBatchResult str2flt32batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, flt32* dst, uintxx maxcount);
+
+/*
+ * Same as above for binary16 and bfloat16, dst receives the bits. */
+CTOOLBOX_API
+TToFltBatchResult str2flt16batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, uint16* dst, uintxx maxcount);
+
+CTOOLBOX_API
+TToFltBatchResult str2bf16batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, uint16* dst, uintxx maxcount);
+
+/*
+ * Converts a JSON number of at most total characters in one pass. The JSON
+ * grammar is strict (no "+" sign, no leading zeros, no "inf" or "nan" and
+ * digits are required on both sides of the decimal point). Integers that
+ * fit are returned as int64 (or uint64 when they exceed the int64 range),
+ * the rest (including "-0") as flt64. If end is not NULL, stores the pointer
+ * to the character that stopped the scan. */
+CTOOLBOX_API
+TToNumberResult jsontonumber(const uint8* src, intxx total, const uint8** end);
+
 
 #endif
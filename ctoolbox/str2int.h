@@ -23,6 +23,7 @@
  */
 
 #include "ctoolbox.h"
+#include "uint128.h"
 
 
  /* Error codes */
@@ -34,6 +35,13 @@ typedef enum {
 } eSTR2INTError;
 
 
+/* Flags for the batch conversion */
+typedef enum {
+	STR2INT_SKIPSPACE  = 0x01,  /* allow white-space around the numbers */
+	STR2INT_ALLOWEMPTY = 0x02   /* store empty fields as zero */
+} eSTR2INTFlags;
+
+
 /*
  * Result of string to integer conversion. */
 struct TToIntResult {
@@ -49,6 +57,31 @@ struct TToIntResult {
 
 typedef struct TToIntResult TToIntResult;
 
+/*
+ * Result of string to 128 bit integer conversion. */
+struct TToU128Result {
+	eintxx error;
+
+	TUInt128 value;
+};
+
+typedef struct TToU128Result TToU128Result;
+
+/*
+ * Result of a batch conversion. */
+struct TToIntBatchResult {
+	eintxx error;
+
+	/* number of values stored */
+	uintxx count;
+
+	/* on error the offset of the invalid character (or of the number out of
+	 * range), otherwise the number of characters consumed */
+	uintxx position;
+};
+
+typedef struct TToIntBatchResult TToIntBatchResult;
+
 
 /*
  * Converts an string (base 2 to base 16) to 32bit or 64bit integer. If end
@@ -65,6 +98,30 @@ TToIntResult strtoi32(const uint8* src, const uint8** end, intxx base);
 CTOOLBOX_API
 TToIntResult strtoi64(const uint8* src, const uint8** end, intxx base);
 
+/*
+ * Converts an string (base 2 to base 16) to 128bit unsigned integer. If end
+ * is not NULL, stores the pointer to the character that stopped the scan. */
+CTOOLBOX_API
+TToU128Result strtou128(const uint8* src, const uint8** end, intxx base);
+
+/*
+ * Same as above but the scan stops after total characters, the string does
+ * not need to be NUL terminated. */
+CTOOLBOX_API
+TToIntResult strtou32n(const uint8* src, intxx total, const uint8** end, intxx base);
+
+CTOOLBOX_API
+TToIntResult strtou64n(const uint8* src, intxx total, const uint8** end, intxx base);
+
+CTOOLBOX_API
+TToIntResult strtoi32n(const uint8* src, intxx total, const uint8** end, intxx base);
+
+CTOOLBOX_API
+TToIntResult strtoi64n(const uint8* src, intxx total, const uint8** end, intxx base);
+
+CTOOLBOX_API
+TToU128Result strtou128n(const uint8* src, intxx total, const uint8** end, intxx base);
+
 
 /*
  * Converts a decimal string (base 10) to 32bit or 64bit integer. If end
@@ -81,6 +138,27 @@ TToIntResult dcmltoi32(const uint8* src, intxx total, const uint8** end);
 CTOOLBOX_API
 TToIntResult dcmltoi64(const uint8* src, intxx total, const uint8** end);
 
+/*
+ * Converts a fixed point decimal string ("-12.5", ".25" or "3.") to an
+ * integer scaled by 10^scale (scale from 0 to 19) without going through a
+ * float. The digits past scale are rounded to nearest (ties to even) and
+ * STR2INT_ERANGE is returned (with the value saturated) if the scaled number
+ * does not fit. If end is not NULL, stores the pointer to the character that
+ * stopped the scan. */
+CTOOLBOX_API
+TToIntResult strtoscaledi64(const uint8* src, intxx total, uintxx scale, const uint8** end);
+
+/*
+ * Converts up to maxcount decimal integers separated by any of the characters
+ * in delimiters (a NUL terminated string). A delimiter is always followed by
+ * a field, so "1,2," holds three. Stops at the first invalid field, the
+ * values before it are stored. */
+CTOOLBOX_API
+TToIntBatchResult dcmltou64batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, uint64* dst, uintxx maxcount);
+
+CTOOLBOX_API
+TToIntBatchResult dcmltoi64batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, int64* dst, uintxx maxcount);
+
 
 /*
  * Converts a hexadecimal string (base 16) to integer. */
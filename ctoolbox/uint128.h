@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef a3f806b4_6db5_407d_a9ac_259d6023f9dd
+#define a3f806b4_6db5_407d_a9ac_259d6023f9dd
+
+/*
+ * uint128.h
+ * 128 bit unsigned integer arithmetic.
+ */
+
+#include "ctoolbox.h"
+
+
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+	#define CTB_HAS_INT128
+#endif
+
+
+/*
+ * 128 bit unsigned integer. */
+struct TUInt128 {
+	uint64 hi;
+	uint64 lo;
+};
+
+typedef struct TUInt128 TUInt128;
+
+
+/*
+ * Builds a 128 bit integer from its high and low halves. */
+CTB_INLINE
+TUInt128 ctb_u128(uint64 hi, uint64 lo);
+
+/*
+ * Full product of two 64 bit integers. */
+CTB_INLINE
+TUInt128 ctb_mul64to128(uint64 lhs, uint64 rhs);
+
+/*
+ * High half of the product of two 64 bit integers. */
+CTB_INLINE
+uint64 ctb_mul128hi(uint64 lhs, uint64 rhs);
+
+/*
+ * Modular (wrap around) addition, subtraction and multiplication. */
+CTB_INLINE
+TUInt128 ctb_u128add(TUInt128 lhs, TUInt128 rhs);
+
+CTB_INLINE
+TUInt128 ctb_u128sub(TUInt128 lhs, TUInt128 rhs);
+
+CTB_INLINE
+TUInt128 ctb_u128mul(TUInt128 lhs, TUInt128 rhs);
+
+/*
+ * Logical shifts, n must be less than 128. */
+CTB_INLINE
+TUInt128 ctb_u128shl(TUInt128 v, uintxx n);
+
+CTB_INLINE
+TUInt128 ctb_u128shr(TUInt128 v, uintxx n);
+
+/*
+ * Returns -1, 0 or 1 if lhs is less than, equal to or greater than rhs. */
+CTB_INLINE
+intxx ctb_u128cmp(TUInt128 lhs, TUInt128 rhs);
+
+
+/*
+ * Division by a 64 bit divisor (must not be zero). Returns the quotient, if
+ * r is not NULL stores the remainder. */
+CTOOLBOX_API
+TUInt128 ctb_u128divmod64(TUInt128 n, uint64 d, uint64* r);
+
+/*
+ * Division (the divisor must not be zero). Returns the quotient, if r is not
+ * NULL stores the remainder. */
+CTOOLBOX_API
+TUInt128 ctb_u128divmod(TUInt128 n, TUInt128 d, TUInt128* r);
+
+
+/*
+ * Inlines */
+
+#if defined(CTB_HAS_INT128)
+
+CTB_INLINE __uint128_t
+ctb_u128tonative(TUInt128 v)
+{
+	return (((__uint128_t) v.hi) << 64) | v.lo;
+}
+
+CTB_INLINE TUInt128
+ctb_u128fromnative(__uint128_t v)
+{
+	TUInt128 r;
+
+	r.hi = (uint64) (v >> 64);
+	r.lo = (uint64) (v >> 00);
+	return r;
+}
+
+#endif
+
+
+CTB_INLINE TUInt128
+ctb_u128(uint64 hi, uint64 lo)
+{
+	TUInt128 r;
+
+	r.hi = hi;
+	r.lo = lo;
+	return r;
+}
+
+CTB_INLINE TUInt128
+ctb_mul64to128(uint64 lhs, uint64 rhs)
+{
+#if defined(CTB_HAS_INT128)
+	return ctb_u128fromnative(((__uint128_t) lhs) * ((__uint128_t) rhs));
+#else
+	/*
+	 * Taken from xxHash3
+	 * See also: https://stackoverflow.com/a/58381061 */
+	uint64 loxlo;
+	uint64 loxhi;
+	uint64 hixlo;
+	uint64 hixhi;
+	uint64 upper;
+	uint64 cross;
+	TUInt128 r;
+
+	/* first calculate all of the cross products. */
+	loxlo = (lhs & 0xffffffff) * (rhs & 0xffffffff);
+	hixlo = (lhs >> 32)        * (rhs & 0xffffffff);
+	loxhi = (lhs & 0xffffffff) * (rhs >> 32);
+	hixhi = (lhs >> 32)        * (rhs >> 32);
+
+	/* now add the products together. These will never overflow. */
+	cross = (loxlo >> 32) + (hixlo & 0xffffffff) + loxhi;
+	upper = (hixlo >> 32) + (cross >> 32)        + hixhi;
+
+	r.hi = upper;
+	r.lo = (cross << 32) | (loxlo & 0xffffffff);
+	return r;
+#endif
+}
+
+CTB_INLINE uint64
+ctb_mul128hi(uint64 lhs, uint64 rhs)
+{
+	return ctb_mul64to128(lhs, rhs).hi;
+}
+
+CTB_INLINE TUInt128
+ctb_u128add(TUInt128 lhs, TUInt128 rhs)
+{
+#if defined(CTB_HAS_INT128)
+	return ctb_u128fromnative(ctb_u128tonative(lhs) + ctb_u128tonative(rhs));
+#else
+	TUInt128 r;
+
+	r.lo = lhs.lo + rhs.lo;
+	r.hi = lhs.hi + rhs.hi + (r.lo < lhs.lo);
+	return r;
+#endif
+}
+
+CTB_INLINE TUInt128
+ctb_u128sub(TUInt128 lhs, TUInt128 rhs)
+{
+#if defined(CTB_HAS_INT128)
+	return ctb_u128fromnative(ctb_u128tonative(lhs) - ctb_u128tonative(rhs));
+#else
+	TUInt128 r;
+
+	r.lo = lhs.lo - rhs.lo;
+	r.hi = lhs.hi - rhs.hi - (lhs.lo < rhs.lo);
+	return r;
+#endif
+}
+
+CTB_INLINE TUInt128
+ctb_u128mul(TUInt128 lhs, TUInt128 rhs)
+{
+#if defined(CTB_HAS_INT128)
+	return ctb_u128fromnative(ctb_u128tonative(lhs) * ctb_u128tonative(rhs));
+#else
+	TUInt128 r;
+
+	r = ctb_mul64to128(lhs.lo, rhs.lo);
+	r.hi += (lhs.hi * rhs.lo) + (lhs.lo * rhs.hi);
+	return r;
+#endif
+}
+
+CTB_INLINE TUInt128
+ctb_u128shl(TUInt128 v, uintxx n)
+{
+#if defined(CTB_HAS_INT128)
+	CTB_ASSERT(n < 128);
+
+	return ctb_u128fromnative(ctb_u128tonative(v) << n);
+#else
+	TUInt128 r;
+	CTB_ASSERT(n < 128);
+
+	if (n >= 64) {
+		r.hi = v.lo << (n - 64);
+		r.lo = 0;
+		return r;
+	}
+	if (n == 0) {
+		return v;
+	}
+	r.hi = (v.hi << n) | (v.lo >> (64 - n));
+	r.lo = (v.lo << n);
+	return r;
+#endif
+}
+
+CTB_INLINE TUInt128
+ctb_u128shr(TUInt128 v, uintxx n)
+{
+#if defined(CTB_HAS_INT128)
+	CTB_ASSERT(n < 128);
+
+	return ctb_u128fromnative(ctb_u128tonative(v) >> n);
+#else
+	TUInt128 r;
+	CTB_ASSERT(n < 128);
+
+	if (n >= 64) {
+		r.hi = 0;
+		r.lo = v.hi >> (n - 64);
+		return r;
+	}
+	if (n == 0) {
+		return v;
+	}
+	r.hi = (v.hi >> n);
+	r.lo = (v.lo >> n) | (v.hi << (64 - n));
+	return r;
+#endif
+}
+
+CTB_INLINE intxx
+ctb_u128cmp(TUInt128 lhs, TUInt128 rhs)
+{
+	if (lhs.hi != rhs.hi) {
+		return lhs.hi < rhs.hi ? -1 : 1;
+	}
+	if (lhs.lo != rhs.lo) {
+		return lhs.lo < rhs.lo ? -1 : 1;
+	}
+	return 0;
+}
+
+
+#endif
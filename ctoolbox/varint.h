@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef e5616509_51e1_48df_9c5e_c351e03e2983
+#define e5616509_51e1_48df_9c5e_c351e03e2983
+
+/*
+ * varint.h
+ * Variable length integer encodings: LEB128, zigzag and Stream VByte.
+ */
+
+#include "ctoolbox.h"
+
+
+/* Error codes */
+typedef enum {
+	VARINT_OK     = 0,
+	VARINT_ESIZE  = 1,  /* the input ends inside an integer */
+	VARINT_ERANGE = 2   /* too many bytes or the value does not fit */
+} eVARINTError;
+
+
+/* Maximum size of an encoded integer */
+#define VARINT_MAXSIZE32 5
+#define VARINT_MAXSIZE64 10
+
+
+/*
+ * Zigzag mapping of signed integers to unsigned ones (0, -1, 1, -2, 2 ...
+ * map to 0, 1, 2, 3, 4 ...) so small magnitudes get short encodings. */
+CTB_INLINE
+uint32 ctb_zigzagencode32(int32 n);
+
+CTB_INLINE
+uint64 ctb_zigzagencode64(int64 n);
+
+CTB_INLINE
+int32 ctb_zigzagdecode32(uint32 n);
+
+CTB_INLINE
+int64 ctb_zigzagdecode64(uint64 n);
+
+/*
+ * Returns the number of bytes of the LEB128 encoding of n. */
+CTB_INLINE
+uintxx ctb_varintsizeu64(uint64 n);
+
+
+/*
+ * LEB128 encoding, dst must hold VARINT_MAXSIZE32 (or VARINT_MAXSIZE64)
+ * bytes. The signed variants use the sign extended encoding (SLEB128), for
+ * the protobuf "sint" encoding use the zigzag mapping and the unsigned
+ * variants. Returns the number of bytes written. */
+CTOOLBOX_API
+uintxx ctb_varintencodeu32(uint32 n, uint8* dst);
+
+CTOOLBOX_API
+uintxx ctb_varintencodeu64(uint64 n, uint8* dst);
+
+CTOOLBOX_API
+uintxx ctb_varintencodei32(int32 n, uint8* dst);
+
+CTOOLBOX_API
+uintxx ctb_varintencodei64(int64 n, uint8* dst);
+
+/*
+ * Decodes a LEB128 integer of at most size bytes. If end is not NULL, stores
+ * the pointer to the byte that follows the integer (src on error). */
+CTOOLBOX_API
+eintxx ctb_varintdecodeu32(const uint8* src, uintxx size, uint32* r, const uint8** end);
+
+CTOOLBOX_API
+eintxx ctb_varintdecodeu64(const uint8* src, uintxx size, uint64* r, const uint8** end);
+
+CTOOLBOX_API
+eintxx ctb_varintdecodei32(const uint8* src, uintxx size, int32* r, const uint8** end);
+
+CTOOLBOX_API
+eintxx ctb_varintdecodei64(const uint8* src, uintxx size, int64* r, const uint8** end);
+
+/*
+ * Decodes count consecutive LEB128 integers. If end is not NULL, stores the
+ * pointer to the byte that follows the last integer, on error the integers
+ * before the invalid one are stored and end points to it. */
+CTOOLBOX_API
+eintxx ctb_varintdecodeu32batch(const uint8* src, uintxx size, uint32* dst, uintxx count, const uint8** end);
+
+CTOOLBOX_API
+eintxx ctb_varintdecodeu64batch(const uint8* src, uintxx size, uint64* dst, uintxx count, const uint8** end);
+
+
+/*
+ * Stream VByte (Lemire, Kurz and Rupp). The byte lengths of four integers
+ * are packed in a control byte, the (count + 3) / 4 control bytes are
+ * followed by the data bytes. Since the lengths are known in advance, four
+ * integers are decoded with a single shuffle.
+ * Returns the maximum size of the encoding of count integers. */
+CTB_INLINE
+uintxx ctb_streamvbytemaxsize(uintxx count);
+
+/*
+ * Encodes count integers, dst must hold ctb_streamvbytemaxsize(count) bytes.
+ * Returns the number of bytes written. */
+CTOOLBOX_API
+uintxx ctb_streamvbyteencode(const uint32* src, uintxx count, uint8* dst);
+
+/*
+ * Decodes count integers from at most size bytes. If end is not NULL,
+ * stores the pointer to the byte that follows the encoding. */
+CTOOLBOX_API
+eintxx ctb_streamvbytedecode(const uint8* src, uintxx size, uint32* dst, uintxx count, const uint8** end);
+
+
+/*
+ * Inlines */
+
+CTB_INLINE uint32
+ctb_zigzagencode32(int32 n)
+{
+	return ((uint32) n << 1) ^ (0 - ((uint32) n >> 31));
+}
+
+CTB_INLINE uint64
+ctb_zigzagencode64(int64 n)
+{
+	return ((uint64) n << 1) ^ (0 - ((uint64) n >> 63));
+}
+
+CTB_INLINE int32
+ctb_zigzagdecode32(uint32 n)
+{
+	return (int32) ((n >> 1) ^ (0 - (n & 1)));
+}
+
+CTB_INLINE int64
+ctb_zigzagdecode64(uint64 n)
+{
+	return (int64) ((n >> 1) ^ (0 - (n & 1)));
+}
+
+CTB_INLINE uintxx
+ctb_varintsizeu64(uint64 n)
+{
+	uintxx j;
+
+	for (j = 1; n >= 0x80; j++) {
+		n >>= 7;
+	}
+	return j;
+}
+
+CTB_INLINE uintxx
+ctb_streamvbytemaxsize(uintxx count)
+{
+	return ((count + 3) >> 2) + (count << 2);
+}
+
+
+#endif
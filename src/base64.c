@@ -0,0 +1,673 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ctoolbox/base64.h>
+#include <ctoolbox/cpuinfo.h>
+
+#if defined(CTB_X86SIMD)
+	#include <immintrin.h>
+#endif
+
+
+static const uint8 stdalphabet[] =
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static const uint8 urlalphabet[] =
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+
+/* 0xff for invalid characters and 0xfe for the padding */
+static const uint8 stdvalues[] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+	0x3c, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+	0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+	0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+	0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+	0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+	0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+	0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8 urlvalues[] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+	0x3c, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+	0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+	0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+	0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+	0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0x3f,
+	0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+	0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+	0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+#define PADDING 0xfe
+
+
+/* ****************************************************************************
+ * Scalar kernels
+ *************************************************************************** */
+
+static uintxx
+encodescalar(const uint8* src, uintxx size, uint8* dst, const uint8* alphabet)
+{
+	uint32 v;
+	const uint8* s;
+
+	for (s = src; size >= 3; size -= 3) {
+		v = ((uint32) s[0] << 16) | ((uint32) s[1] << 8) | s[2];
+		dst[0] = alphabet[(v >> 18)];
+		dst[1] = alphabet[(v >> 12) & 0x3f];
+		dst[2] = alphabet[(v >> 06) & 0x3f];
+		dst[3] = alphabet[(v >> 00) & 0x3f];
+		dst += 4;
+		s += 3;
+	}
+	return (uintxx) (s - src);
+}
+
+static uintxx
+encodetail(const uint8* src, uintxx size, uint8* dst, uintxx flags)
+{
+	uint32 v;
+	const uint8* alphabet;
+
+	alphabet = stdalphabet;
+	if (flags & BASE64_URLSAFE) {
+		alphabet = urlalphabet;
+	}
+
+	switch (size) {
+		case 1:
+			v = (uint32) src[0] << 16;
+			dst[0] = alphabet[(v >> 18)];
+			dst[1] = alphabet[(v >> 12) & 0x3f];
+			if (flags & BASE64_NOPAD) {
+				return 2;
+			}
+			dst[2] = '=';
+			dst[3] = '=';
+			return 4;
+		case 2:
+			v = ((uint32) src[0] << 16) | ((uint32) src[1] << 8);
+			dst[0] = alphabet[(v >> 18)];
+			dst[1] = alphabet[(v >> 12) & 0x3f];
+			dst[2] = alphabet[(v >> 06) & 0x3f];
+			if (flags & BASE64_NOPAD) {
+				return 3;
+			}
+			dst[3] = '=';
+			return 4;
+	}
+	return 0;
+}
+
+/*
+ * Decodes complete groups of four characters, stops at the first group that
+ * contains padding or an invalid character. */
+static uintxx
+decodescalar(const uint8* src, uintxx size, uint8* dst, const uint8* values)
+{
+	uint32 a;
+	uint32 b;
+	uint32 c;
+	uint32 d;
+	const uint8* s;
+
+	for (s = src; size >= 4; size -= 4) {
+		a = values[s[0]];
+		b = values[s[1]];
+		c = values[s[2]];
+		d = values[s[3]];
+		if (CTB_EXPECT0((a | b | c | d) & 0xc0)) {
+			break;
+		}
+
+		a = (a << 18) | (b << 12) | (c << 6) | d;
+		dst[0] = (uint8) (a >> 16);
+		dst[1] = (uint8) (a >> 8);
+		dst[2] = (uint8) (a >> 0);
+		dst += 3;
+		s += 4;
+	}
+	return (uintxx) (s - src);
+}
+
+/*
+ * Decodes a group of four characters that may be padded. Returns the number
+ * of bytes written or -1 if the group is invalid, the bits of the last
+ * character that don't make up a full byte must be zero. */
+static intxx
+decodegroup(const uint8* src, uint8* dst, const uint8* values)
+{
+	uint32 a;
+	uint32 b;
+	uint32 c;
+	uint32 d;
+
+	a = values[src[0]];
+	b = values[src[1]];
+	c = values[src[2]];
+	d = values[src[3]];
+	if ((a | b) & 0xc0) {
+		return -1;
+	}
+
+	dst[0] = (uint8) ((a << 2) | (b >> 4));
+	if (c == PADDING) {
+		if (d == PADDING && (b & 0x0f) == 0) {
+			return 1;
+		}
+		return -1;
+	}
+	if (c & 0xc0) {
+		return -1;
+	}
+
+	dst[1] = (uint8) ((b << 4) | (c >> 2));
+	if (d == PADDING) {
+		if (c & 0x03) {
+			return -1;
+		}
+		return 2;
+	}
+	if (d & 0xc0) {
+		return -1;
+	}
+
+	dst[2] = (uint8) ((c << 6) | d);
+	return 3;
+}
+
+
+/* ****************************************************************************
+ * SIMD kernels
+ * Based on "Faster Base64 Encoding and Decoding using AVX2 Instructions" by
+ * Wojciech Mula and Daniel Lemire.
+ *************************************************************************** */
+
+#if defined(CTB_X86SIMD)
+
+#if defined(__clang__)
+	#pragma clang diagnostic push
+	#pragma clang diagnostic ignored "-Wcast-align"
+#endif
+
+/*
+ * Consumes 24 bytes per iteration, the second half is loaded from offset 12
+ * so each lane holds the 12 bytes it needs (28 bytes must be readable). */
+CTB_TARGET("avx2") static uintxx
+encodeavx2(const uint8* src, uintxx size, uint8* dst, uintxx flags)
+{
+	uintxx j;
+	__m256i a;
+	__m256i b;
+	__m256i shuffle;
+	__m256i lut;
+
+	shuffle = _mm256_setr_epi8(
+		1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+		1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+	/* offsets from the 6 bit values to the ascii characters */
+	if (flags & BASE64_URLSAFE) {
+		lut = _mm256_setr_epi8(
+			65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -17, 32, 0, 0,
+			65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -17, 32, 0, 0);
+	}
+	else {
+		lut = _mm256_setr_epi8(
+			65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
+			65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+	}
+
+	for (j = 0; size - j >= 28; j += 24) {
+		a = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*) (src + j)));
+		a = _mm256_inserti128_si256(a, _mm_loadu_si128((const __m128i*) (src + j + 12)), 1);
+		a = _mm256_shuffle_epi8(a, shuffle);
+
+		/* split each group of 3 bytes in 4 bytes of 6 bits */
+		b = _mm256_and_si256(a, _mm256_set1_epi32(0x003f03f0));
+		b = _mm256_mullo_epi16(b, _mm256_set1_epi32(0x01000010));
+		a = _mm256_and_si256(a, _mm256_set1_epi32(0x0fc0fc00));
+		a = _mm256_mulhi_epu16(a, _mm256_set1_epi32(0x04000040));
+		a = _mm256_or_si256(a, b);
+
+		/* 0..25 -> 0, 26..51 -> 1, 52..61 -> 2..11, 62 -> 12, 63 -> 13 */
+		b = _mm256_subs_epu8(a, _mm256_set1_epi8(51));
+		b = _mm256_sub_epi8(b, _mm256_cmpgt_epi8(a, _mm256_set1_epi8(25)));
+		a = _mm256_add_epi8(a, _mm256_shuffle_epi8(lut, b));
+
+		_mm256_storeu_si256((__m256i*) dst, a);
+		dst += 32;
+	}
+	return j;
+}
+
+/*
+ * The characters are validated with two nibble lookups (a character is valid
+ * when the class bits of its low and high nibbles don't intersect), then
+ * translated with an offset selected by the high nibble. Stops at the first
+ * block that contains an invalid character or the padding. */
+CTB_TARGET("avx2") static uintxx
+decodeavx2(const uint8* src, uintxx size, uint8* dst, uintxx flags)
+{
+	uintxx j;
+	__m256i a;
+	__m256i h;
+	__m256i l;
+	__m256i m;
+	__m256i luthi;
+	__m256i lutlo;
+	__m256i lutroll;
+
+	if (flags & BASE64_URLSAFE) {
+		luthi = _mm256_setr_epi8(
+			0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+			0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+			0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+			0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+		lutlo = _mm256_setr_epi8(
+			0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+			0x11, 0x11, 0x13, 0x3b, 0x3b, 0x3a, 0x3b, 0x33,
+			0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+			0x11, 0x11, 0x13, 0x3b, 0x3b, 0x3a, 0x3b, 0x33);
+		lutroll = _mm256_setr_epi8(
+			0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, -32, 0, 0,
+			0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, -32, 0, 0);
+	}
+	else {
+		luthi = _mm256_setr_epi8(
+			0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+			0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+			0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+			0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+		lutlo = _mm256_setr_epi8(
+			0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+			0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+			0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+			0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+		lutroll = _mm256_setr_epi8(
+			0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	}
+
+	for (j = 0; size - j >= 32; j += 32) {
+		a = _mm256_loadu_si256((const __m256i*) (src + j));
+
+		m = _mm256_set1_epi8(0x2f);
+		h = _mm256_and_si256(_mm256_srli_epi32(a, 4), m);
+		l = _mm256_and_si256(a, m);
+		l = _mm256_shuffle_epi8(lutlo, l);
+		if (_mm256_testz_si256(l, _mm256_shuffle_epi8(luthi, h)) == 0) {
+			break;
+		}
+
+		/* the characters sharing a high nibble with others ("/" or "_") */
+		if (flags & BASE64_URLSAFE) {
+			m = _mm256_cmpeq_epi8(a, _mm256_set1_epi8(0x5f));
+			h = _mm256_or_si256(h, _mm256_and_si256(m, _mm256_set1_epi8(0x08)));
+		}
+		else {
+			h = _mm256_add_epi8(h, _mm256_cmpeq_epi8(a, m));
+		}
+		a = _mm256_add_epi8(a, _mm256_shuffle_epi8(lutroll, h));
+
+		/* pack the 6 bit values: 4 bytes -> 3 bytes (big endian) */
+		a = _mm256_maddubs_epi16(a, _mm256_set1_epi32(0x01400140));
+		a = _mm256_madd_epi16(a, _mm256_set1_epi32(0x00011000));
+		a = _mm256_shuffle_epi8(a, _mm256_setr_epi8(
+			2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+			2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		a = _mm256_permutevar8x32_epi32(a, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+		_mm_storeu_si128((__m128i*) dst, _mm256_castsi256_si128(a));
+		_mm_storel_epi64((__m128i*) (dst + 16), _mm256_extracti128_si256(a, 1));
+		dst += 24;
+	}
+	return j;
+}
+
+#if defined(__clang__)
+	#pragma clang diagnostic pop
+#endif
+
+#endif
+
+
+
+
+/* ****************************************************************************
+ * Public interface
+ *************************************************************************** */
+
+uintxx
+ctb_base64encodedsize(uintxx size, uintxx flags)
+{
+	uintxx r;
+
+	r = (size / 3) << 2;
+	if (size % 3) {
+		if (flags & BASE64_NOPAD) {
+			return r + (size % 3) + 1;
+		}
+		return r + 4;
+	}
+	return r;
+}
+
+uintxx
+ctb_base64decodedsize(const uint8* src, uintxx size)
+{
+	CTB_ASSERT(src || size == 0);
+
+	if (size && src[size - 1] == '=') {
+		size--;
+		if (size && src[size - 1] == '=') {
+			size--;
+		}
+	}
+
+	if (size & 3) {
+		return ((size >> 2) * 3) + (size & 3) - 1;
+	}
+	return ((size >> 2) * 3);
+}
+
+void
+ctb_base64init(TBase64* state, uintxx flags)
+{
+	CTB_ASSERT(state);
+
+	state->flags = flags;
+	state->done  = 0;
+	state->total = 0;
+}
+
+uintxx
+ctb_base64encodeupdate(TBase64* state, const uint8* src, uintxx size, uint8* dst)
+{
+	uintxx j;
+	uintxx n;
+	uint8* d;
+	const uint8* alphabet;
+	CTB_ASSERT(state && (src || size == 0) && dst);
+
+	alphabet = stdalphabet;
+	if (state->flags & BASE64_URLSAFE) {
+		alphabet = urlalphabet;
+	}
+
+	d = dst;
+	if (state->total) {
+		while (state->total < 3 && size) {
+			state->pending[state->total++] = src[0];
+			src++;
+			size--;
+		}
+		if (state->total < 3) {
+			return 0;
+		}
+
+		encodescalar(state->pending, 3, d, alphabet);
+		state->total = 0;
+		d += 4;
+	}
+
+	j = 0;
+#if defined(CTB_X86SIMD)
+	if (size >= 28 && (ctb_cpufeatures() & CTB_CPU_AVX2)) {
+		j = encodeavx2(src, size, d, state->flags);
+		d += (j / 3) << 2;
+	}
+#endif
+
+	n = encodescalar(src + j, size - j, d, alphabet);
+	d += (n / 3) << 2;
+
+	for (j += n; j < size; j++) {
+		state->pending[state->total++] = src[j];
+	}
+	return (uintxx) (d - dst);
+}
+
+uintxx
+ctb_base64encodefinal(TBase64* state, uint8* dst)
+{
+	uintxx r;
+	CTB_ASSERT(state && dst);
+
+	r = encodetail(state->pending, state->total, dst, state->flags);
+	state->total = 0;
+	return r;
+}
+
+uintxx
+ctb_base64encode(const uint8* src, uintxx size, uint8* dst, uintxx flags)
+{
+	uintxx r;
+	TBase64 state[1];
+	CTB_ASSERT((src || size == 0) && dst);
+
+	ctb_base64init(state, flags);
+	r = ctb_base64encodeupdate(state, src, size, dst);
+	return r + ctb_base64encodefinal(state, dst + r);
+}
+
+
+#define SETTOTAL(T, N) do { if (T) (T)[0] = (N); } while (0)
+
+eintxx
+ctb_base64decodeupdate(TBase64* state, const uint8* src, uintxx size, uint8* dst, uintxx* total)
+{
+	uintxx j;
+	uintxx n;
+	intxx r;
+	uint8* d;
+	const uint8* values;
+	CTB_ASSERT(state && (src || size == 0) && dst);
+
+	values = stdvalues;
+	if (state->flags & BASE64_URLSAFE) {
+		values = urlvalues;
+	}
+
+	d = dst;
+	j = 0;
+	if (state->total) {
+		while (state->total < 4 && j < size) {
+			state->pending[state->total++] = src[j++];
+		}
+		if (state->total < 4) {
+			goto L1;
+		}
+
+		r = decodegroup(state->pending, d, values);
+		if (r == -1) {
+			goto L2;
+		}
+		state->total = 0;
+		d += r;
+		if (r != 3) {
+			state->done = 1;
+		}
+	}
+
+	if (state->done) {
+		if (j < size) {
+			goto L2;
+		}
+		goto L1;
+	}
+
+#if defined(CTB_X86SIMD)
+	if (size - j >= 32 && (ctb_cpufeatures() & CTB_CPU_AVX2)) {
+		n = decodeavx2(src + j, size - j, d, state->flags);
+		d += (n >> 2) * 3;
+		j += n;
+	}
+#endif
+
+	for (;;) {
+		n = decodescalar(src + j, size - j, d, values);
+		d += (n >> 2) * 3;
+		j += n;
+		if (size - j < 4) {
+			break;
+		}
+
+		/* the group contains the padding or an invalid character */
+		r = decodegroup(src + j, d, values);
+		if (r == -1) {
+			goto L2;
+		}
+		d += r;
+		j += 4;
+		if (r != 3) {
+			state->done = 1;
+			if (j < size) {
+				goto L2;
+			}
+			break;
+		}
+	}
+
+	while (j < size) {
+		state->pending[state->total++] = src[j++];
+	}
+
+L1:
+	SETTOTAL(total, (uintxx) (d - dst));
+	return BASE64_OK;
+
+L2:
+	state->total = 0;
+	SETTOTAL(total, (uintxx) (d - dst));
+	return BASE64_EINPUT;
+}
+
+eintxx
+ctb_base64decodefinal(TBase64* state, uint8* dst, uintxx* total)
+{
+	uintxx j;
+	intxx r;
+	uint8 group[4];
+	const uint8* values;
+	CTB_ASSERT(state && dst);
+
+	values = stdvalues;
+	if (state->flags & BASE64_URLSAFE) {
+		values = urlvalues;
+	}
+
+	SETTOTAL(total, 0);
+	if (state->total == 0) {
+		return BASE64_OK;
+	}
+	if (state->total == 1) {
+		state->total = 0;
+		return BASE64_ESIZE;
+	}
+
+	/* the last group without padding */
+	for (j = 0; j < state->total; j++) {
+		group[j] = state->pending[j];
+		if (values[group[j]] == PADDING) {
+			state->total = 0;
+			return BASE64_ESIZE;
+		}
+	}
+	for (; j < 4; j++) {
+		group[j] = '=';
+	}
+	state->total = 0;
+
+	r = decodegroup(group, dst, values);
+	if (r == -1) {
+		return BASE64_EINPUT;
+	}
+	SETTOTAL(total, (uintxx) r);
+	return BASE64_OK;
+}
+
+eintxx
+ctb_base64decode(const uint8* src, uintxx size, uint8* dst, uintxx flags, uintxx* total)
+{
+	uintxx a;
+	uintxx b;
+	eintxx r;
+	TBase64 state[1];
+	CTB_ASSERT((src || size == 0) && dst);
+
+	ctb_base64init(state, flags);
+	r = ctb_base64decodeupdate(state, src, size, dst, &a);
+	if (r) {
+		SETTOTAL(total, a);
+		return r;
+	}
+
+	r = ctb_base64decodefinal(state, dst + a, &b);
+	SETTOTAL(total, a + b);
+	return r;
+}
+
+#undef SETTOTAL
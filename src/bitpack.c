@@ -0,0 +1,560 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <ctoolbox/bitpack.h>
+#include <ctoolbox/cpuinfo.h>
+#include <ctoolbox/ulog2.h>
+#include <ctoolbox/varint.h>
+
+#if defined(CTB_X86SIMD)
+	#include <immintrin.h>
+#endif
+
+
+#define BLOCKSIZE BITPACK_BLOCKSIZE
+
+/* header: bit width and encoding, then the reference values */
+#define HEADERSIZE(M) ((M) == BITPACK_DELTA2 ? 3 : 2)
+
+
+uintxx
+ctb_bitpackwidth(const uint32* src, uintxx count)
+{
+	uintxx j;
+	uint32 n;
+	CTB_ASSERT(src);
+
+	n = 0;
+	for (j = 0; j < count; j++) {
+		n |= src[j];
+	}
+	if (n == 0) {
+		return 0;
+	}
+	return ctb_u32log2(n) + 1;
+}
+
+
+/* ****************************************************************************
+ * Packing
+ * The integer i goes to the lane i % 4, each lane is a run of 32 integers
+ * packed in the words lane, lane + 4, lane + 8 ... (the SIMD-BP128 layout of
+ * Lemire and Boytsov).
+ *************************************************************************** */
+
+#if defined(CTB_X86SIMD)
+
+#if defined(__clang__)
+	#pragma clang diagnostic push
+	#pragma clang diagnostic ignored "-Wcast-align"
+#endif
+
+CTB_TARGET("sse2") static void
+packsse2(const uint32* src, uintxx bits, uint32* dst)
+{
+	uintxx i;
+	uintxx shift;
+	__m128i v;
+	__m128i w;
+
+	w = _mm_setzero_si128();
+	shift = 0;
+	for (i = 0; i < 32; i++) {
+		v = _mm_loadu_si128((const __m128i*) (src + (i << 2)));
+		w = _mm_or_si128(w, _mm_sll_epi32(v, _mm_cvtsi32_si128((int32) shift)));
+
+		shift += bits;
+		if (shift >= 32) {
+			_mm_storeu_si128((__m128i*) dst, w);
+			dst += 4;
+
+			shift -= 32;
+			w = _mm_setzero_si128();
+			if (shift) {
+				w = _mm_srl_epi32(v, _mm_cvtsi32_si128((int32) (bits - shift)));
+			}
+		}
+	}
+}
+
+/*
+ * Unpacks the group of four at bit offset I * bits, the next word is only
+ * read when the group crosses it. */
+#define UNPACKSTEP(I) \
+	o = (I) * bits; \
+	w = (o >> 5) << 2; \
+	o = o & 31; \
+	a = _mm_srli_epi32(_mm_loadu_si128((const __m128i*) (src + w)), (int) o); \
+	if (o + bits > 32) { \
+		b = _mm_loadu_si128((const __m128i*) (src + w + 4)); \
+		a = _mm_or_si128(a, _mm_slli_epi32(b, (int) (32 - o))); \
+	} \
+	_mm_storeu_si128((__m128i*) (dst + ((I) << 2)), _mm_and_si128(a, m));
+
+/*
+ * Once inlined with a constant width the offsets and shifts are constants
+ * too, the 32 steps become straight line code like the generated unpackers
+ * of SIMD-BP128. */
+CTB_TARGET("sse2") CTB_FORCEINLINE void
+unpackwsse2(const uint32* src, uintxx bits, uint32* dst)
+{
+	uintxx o;
+	uintxx w;
+	__m128i a;
+	__m128i b;
+	__m128i m;
+
+	m = _mm_set1_epi32((int32) (0xffffffffu >> (32 - bits)));
+	UNPACKSTEP( 0) UNPACKSTEP( 1) UNPACKSTEP( 2) UNPACKSTEP( 3) UNPACKSTEP( 4) UNPACKSTEP( 5) UNPACKSTEP( 6) UNPACKSTEP( 7)
+	UNPACKSTEP( 8) UNPACKSTEP( 9) UNPACKSTEP(10) UNPACKSTEP(11) UNPACKSTEP(12) UNPACKSTEP(13) UNPACKSTEP(14) UNPACKSTEP(15)
+	UNPACKSTEP(16) UNPACKSTEP(17) UNPACKSTEP(18) UNPACKSTEP(19) UNPACKSTEP(20) UNPACKSTEP(21) UNPACKSTEP(22) UNPACKSTEP(23)
+	UNPACKSTEP(24) UNPACKSTEP(25) UNPACKSTEP(26) UNPACKSTEP(27) UNPACKSTEP(28) UNPACKSTEP(29) UNPACKSTEP(30) UNPACKSTEP(31)
+}
+
+#define UNPACKCASE(N) case N: unpackwsse2(src, N, dst); break;
+
+CTB_TARGET("sse2") static void
+unpacksse2(const uint32* src, uintxx bits, uint32* dst)
+{
+	switch (bits) {
+		UNPACKCASE( 1) UNPACKCASE( 2) UNPACKCASE( 3) UNPACKCASE( 4) UNPACKCASE( 5) UNPACKCASE( 6) UNPACKCASE( 7) UNPACKCASE( 8)
+		UNPACKCASE( 9) UNPACKCASE(10) UNPACKCASE(11) UNPACKCASE(12) UNPACKCASE(13) UNPACKCASE(14) UNPACKCASE(15) UNPACKCASE(16)
+		UNPACKCASE(17) UNPACKCASE(18) UNPACKCASE(19) UNPACKCASE(20) UNPACKCASE(21) UNPACKCASE(22) UNPACKCASE(23) UNPACKCASE(24)
+		UNPACKCASE(25) UNPACKCASE(26) UNPACKCASE(27) UNPACKCASE(28) UNPACKCASE(29) UNPACKCASE(30) UNPACKCASE(31) UNPACKCASE(32)
+	}
+}
+
+#undef UNPACKSTEP
+#undef UNPACKCASE
+
+#if defined(__clang__)
+	#pragma clang diagnostic pop
+#endif
+
+#endif
+
+uintxx
+ctb_bitpack128(const uint32* src, uintxx bits, uint32* dst)
+{
+	uintxx i;
+	uintxx k;
+	uintxx l;
+	uintxx shift;
+	uint32 v;
+	uint32 w;
+	CTB_ASSERT(src && dst && bits <= 32);
+
+	if (bits == 0) {
+		return 0;
+	}
+
+#if defined(CTB_X86SIMD)
+	if (ctb_cpufeatures() & CTB_CPU_SSE2) {
+		packsse2(src, bits, dst);
+		return bits << 2;
+	}
+#endif
+
+	for (l = 0; l < 4; l++) {
+		w = 0;
+		k = l;
+		shift = 0;
+		for (i = 0; i < 32; i++) {
+			v = src[(i << 2) + l];
+			w = w | (v << shift);
+
+			shift += bits;
+			if (shift >= 32) {
+				dst[k] = w;
+				k += 4;
+
+				shift -= 32;
+				w = 0;
+				if (shift) {
+					w = v >> (bits - shift);
+				}
+			}
+		}
+	}
+	return bits << 2;
+}
+
+uintxx
+ctb_bitunpack128(const uint32* src, uintxx bits, uint32* dst)
+{
+	uintxx i;
+	uintxx k;
+	uintxx l;
+	uintxx shift;
+	uint32 v;
+	uint32 w;
+	uint32 m;
+	CTB_ASSERT(src && dst && bits <= 32);
+
+	if (bits == 0) {
+		for (i = 0; i < BLOCKSIZE; i++) {
+			dst[i] = 0;
+		}
+		return 0;
+	}
+
+#if defined(CTB_X86SIMD)
+	if (ctb_cpufeatures() & CTB_CPU_SSE2) {
+		unpacksse2(src, bits, dst);
+		return bits << 2;
+	}
+#endif
+
+	m = 0xffffffffu >> (32 - bits);
+	for (l = 0; l < 4; l++) {
+		k = l;
+		w = src[k];
+		shift = 0;
+		for (i = 0; i < 32; i++) {
+			v = w >> shift;
+
+			shift += bits;
+			if (shift >= 32 && i != 31) {
+				k += 4;
+				w = src[k];
+
+				shift -= 32;
+				if (shift) {
+					v = v | (w << (bits - shift));
+				}
+			}
+			dst[(i << 2) + l] = v & m;
+		}
+	}
+	return bits << 2;
+}
+
+
+/* ****************************************************************************
+ * Encoding
+ *************************************************************************** */
+
+uintxx
+ctb_bitpackencode(const uint32* src, uintxx count, uintxx mode, uint32* dst)
+{
+	uintxx i;
+	uintxx j;
+	uintxx k;
+	uintxx n;
+	uintxx bits;
+	uint32 r1;
+	uint32 r2;
+	uint32 d;
+	uint32 buffer[BLOCKSIZE];
+	CTB_ASSERT(src && dst && mode <= BITPACK_DELTA2);
+
+	r1 = 0;
+	r2 = 0;
+	k = 0;
+	for (j = 0; j < count; j += n) {
+		n = count - j;
+		if (n > BLOCKSIZE) {
+			n = BLOCKSIZE;
+		}
+
+		/* the references are the last integer (and difference) of the
+		 * previous block */
+		dst[k + 1] = r1;
+		if (mode == BITPACK_DELTA2) {
+			dst[k + 2] = r2;
+		}
+		switch (mode) {
+			case BITPACK_FOR:
+				r1 = src[j];
+				for (i = 1; i < n; i++) {
+					if (src[j + i] < r1)
+						r1 = src[j + i];
+				}
+				for (i = 0; i < n; i++) {
+					buffer[i] = src[j + i] - r1;
+				}
+				dst[k + 1] = r1;
+				break;
+
+			case BITPACK_DELTA:
+				for (i = 0; i < n; i++) {
+					buffer[i] = src[j + i] - r1;
+					r1 = src[j + i];
+				}
+				break;
+
+			case BITPACK_DELTA2:
+				for (i = 0; i < n; i++) {
+					d = src[j + i] - r1;
+					buffer[i] = ctb_zigzagencode32((int32) (d - r2));
+					r1 = src[j + i];
+					r2 = d;
+				}
+				break;
+		}
+		for (i = n; i < BLOCKSIZE; i++) {
+			buffer[i] = 0;
+		}
+
+		bits = ctb_bitpackwidth(buffer, BLOCKSIZE);
+		dst[k] = (uint32) (bits | (mode << 8));
+		k += HEADERSIZE(mode);
+		k += ctb_bitpack128(buffer, bits, dst + k);
+	}
+	return k;
+}
+
+
+/* ****************************************************************************
+ * Decoding
+ *************************************************************************** */
+
+#if defined(CTB_X86SIMD)
+
+#if defined(__clang__)
+	#pragma clang diagnostic push
+	#pragma clang diagnostic ignored "-Wcast-align"
+#endif
+
+/*
+ * Prefix sums of the eight integers in a and b plus the carry c, which is
+ * updated with the last sum. The sums of each half are made with two shifted
+ * additions, only the final addition of the carry is a serial dependency. */
+CTB_TARGET("sse2") CTB_FORCEINLINE void
+prefixsum8(__m128i* a, __m128i* b, __m128i* c)
+{
+	__m128i x;
+	__m128i y;
+
+	x = a[0];
+	y = b[0];
+	x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+	y = _mm_add_epi32(y, _mm_slli_si128(y, 4));
+	x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+	y = _mm_add_epi32(y, _mm_slli_si128(y, 8));
+	y = _mm_add_epi32(y, _mm_shuffle_epi32(x, 0xff));
+
+	a[0] = _mm_add_epi32(x, c[0]);
+	b[0] = _mm_add_epi32(y, c[0]);
+	c[0] = _mm_shuffle_epi32(b[0], 0xff);
+}
+
+/*
+ * Zigzag decoding. */
+CTB_TARGET("sse2") CTB_FORCEINLINE __m128i
+unzigzagsse2(__m128i a)
+{
+	__m128i b;
+
+	b = _mm_and_si128(a, _mm_set1_epi32(1));
+	return _mm_xor_si128(_mm_srli_epi32(a, 1), _mm_sub_epi32(_mm_setzero_si128(), b));
+}
+
+CTB_TARGET("sse2") static void
+undeltasse2(uint32* dst, uintxx mode, uint32 r1, uint32 r2)
+{
+	uintxx i;
+	__m128i a;
+	__m128i b;
+	__m128i c1;
+	__m128i c2;
+
+	c1 = _mm_set1_epi32((int32) r1);
+	c2 = _mm_set1_epi32((int32) r2);
+	for (i = 0; i < BLOCKSIZE; i += 8) {
+		a = _mm_loadu_si128((const __m128i*) (dst + i + 0));
+		b = _mm_loadu_si128((const __m128i*) (dst + i + 4));
+		if (mode == BITPACK_DELTA2) {
+			a = unzigzagsse2(a);
+			b = unzigzagsse2(b);
+			prefixsum8(&a, &b, &c2);
+		}
+		prefixsum8(&a, &b, &c1);
+
+		_mm_storeu_si128((__m128i*) (dst + i + 0), a);
+		_mm_storeu_si128((__m128i*) (dst + i + 4), b);
+	}
+}
+
+CTB_TARGET("sse2") static void
+unforsse2(uint32* dst, uint32 r1)
+{
+	uintxx i;
+	__m128i a;
+	__m128i c;
+
+	c = _mm_set1_epi32((int32) r1);
+	for (i = 0; i < BLOCKSIZE; i += 4) {
+		a = _mm_loadu_si128((const __m128i*) (dst + i));
+		_mm_storeu_si128((__m128i*) (dst + i), _mm_add_epi32(a, c));
+	}
+}
+
+#if defined(__clang__)
+	#pragma clang diagnostic pop
+#endif
+
+#endif
+
+static eintxx
+readheader(const uint32* src, uintxx size, uintxx* bits, uintxx* mode, uintxx* total)
+{
+	uint32 h;
+
+	if (size == 0) {
+		return BITPACK_ESIZE;
+	}
+	h = src[0];
+
+	bits[0] = h & 0xff;
+	mode[0] = h >> 8;
+	if (bits[0] > 32 || mode[0] > BITPACK_DELTA2) {
+		return BITPACK_EINPUT;
+	}
+
+	total[0] = HEADERSIZE(mode[0]) + (bits[0] << 2);
+	if (size < total[0]) {
+		return BITPACK_ESIZE;
+	}
+	return BITPACK_OK;
+}
+
+eintxx
+ctb_bitpackdecodeblock(const uint32* src, uintxx size, uint32* dst, uintxx* total)
+{
+	uintxx i;
+	uintxx n;
+	uintxx bits;
+	uintxx mode;
+	uint32 r1;
+	uint32 r2;
+	eintxx e;
+	CTB_ASSERT(src && dst);
+
+	e = readheader(src, size, &bits, &mode, &n);
+	if (CTB_EXPECT0(e != 0)) {
+		if (total)
+			total[0] = 0;
+		return e;
+	}
+	r1 = src[1];
+	r2 = mode == BITPACK_DELTA2 ? src[2] : 0;
+	ctb_bitunpack128(src + HEADERSIZE(mode), bits, dst);
+
+#if defined(CTB_X86SIMD)
+	if (ctb_cpufeatures() & CTB_CPU_SSE2) {
+		if (mode == BITPACK_FOR) {
+			unforsse2(dst, r1);
+		}
+		else {
+			undeltasse2(dst, mode, r1, r2);
+		}
+		goto L1;
+	}
+#endif
+
+	switch (mode) {
+		case BITPACK_FOR:
+			for (i = 0; i < BLOCKSIZE; i++) {
+				dst[i] += r1;
+			}
+			break;
+
+		case BITPACK_DELTA:
+			for (i = 0; i < BLOCKSIZE; i++) {
+				dst[i] = r1 = r1 + dst[i];
+			}
+			break;
+
+		case BITPACK_DELTA2:
+			for (i = 0; i < BLOCKSIZE; i++) {
+				r2 += (uint32) ctb_zigzagdecode32(dst[i]);
+				dst[i] = r1 = r1 + r2;
+			}
+			break;
+	}
+
+#if defined(CTB_X86SIMD)
+L1:
+#endif
+	if (total)
+		total[0] = n;
+	return BITPACK_OK;
+}
+
+eintxx
+ctb_bitpackdecode(const uint32* src, uintxx size, uint32* dst, uintxx count, uintxx* total)
+{
+	uintxx i;
+	uintxx j;
+	uintxx k;
+	uintxx n;
+	eintxx e;
+	uint32 buffer[BLOCKSIZE];
+	CTB_ASSERT(src && dst);
+
+	e = BITPACK_OK;
+	k = 0;
+	for (j = 0; j < count; j += BLOCKSIZE) {
+		if (count - j >= BLOCKSIZE) {
+			e = ctb_bitpackdecodeblock(src + k, size - k, dst + j, &n);
+		}
+		else {
+			e = ctb_bitpackdecodeblock(src + k, size - k, buffer, &n);
+			if (e == 0) {
+				for (i = 0; i < count - j; i++) {
+					dst[j + i] = buffer[i];
+				}
+			}
+		}
+		if (CTB_EXPECT0(e != 0)) {
+			break;
+		}
+		k += n;
+	}
+
+	if (total)
+		total[0] = k;
+	return e;
+}
+
+eintxx
+ctb_bitpackindex(const uint32* src, uintxx size, uintxx count, uintxx* offsets)
+{
+	uintxx j;
+	uintxx k;
+	uintxx n;
+	uintxx bits;
+	uintxx mode;
+	eintxx e;
+	CTB_ASSERT(src && offsets);
+
+	k = 0;
+	for (j = 0; j < count; j += BLOCKSIZE) {
+		e = readheader(src + k, size - k, &bits, &mode, &n);
+		if (CTB_EXPECT0(e != 0)) {
+			return e;
+		}
+		offsets[j / BLOCKSIZE] = k;
+		k += n;
+	}
+	return BITPACK_OK;
+}
+
+
+#undef BLOCKSIZE
+#undef HEADERSIZE
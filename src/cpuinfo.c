@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ctoolbox/cpuinfo.h>
+
+#if defined(CTB_X86SIMD) && defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+
+/* set once the features have been detected */
+#define CPUFEATURES_READY 0x8000
+
+
+static uintxx
+detectfeatures(void)
+{
+	uintxx r;
+
+	r = 0;
+#if defined(CTB_X86SIMD)
+#if defined(__GNUC__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("sse2"))
+		r |= CTB_CPU_SSE2;
+	if (__builtin_cpu_supports("ssse3"))
+		r |= CTB_CPU_SSSE3;
+	if (__builtin_cpu_supports("sse4.1"))
+		r |= CTB_CPU_SSE41;
+	if (__builtin_cpu_supports("avx2"))
+		r |= CTB_CPU_AVX2;
+	if (__builtin_cpu_supports("bmi2"))
+		r |= CTB_CPU_BMI2;
+#else
+	int info[4];
+	int total;
+
+	__cpuid(info, 0);
+	total = info[0];
+
+	__cpuid(info, 1);
+	if (info[3] & (1 << 26))
+		r |= CTB_CPU_SSE2;
+	if (info[2] & (1 << 9))
+		r |= CTB_CPU_SSSE3;
+	if (info[2] & (1 << 19))
+		r |= CTB_CPU_SSE41;
+
+	if (total >= 7) {
+		int osxsave;
+
+		/* the os must save the ymm registers (osxsave, avx and xcr0) */
+		osxsave = (info[2] & (1 << 27)) && (info[2] & (1 << 28));
+		if (osxsave) {
+			osxsave = (_xgetbv(0) & 0x06) == 0x06;
+		}
+
+		__cpuidex(info, 7, 0);
+		if (osxsave && (info[1] & (1 << 5)))
+			r |= CTB_CPU_AVX2;
+		if (info[1] & (1 << 8))
+			r |= CTB_CPU_BMI2;
+	}
+#endif
+#endif
+	return r;
+}
+
+
+static volatile uintxx cpufeatures = 0;
+
+uintxx
+ctb_cpufeatures(void)
+{
+	uintxx r;
+
+	r = cpufeatures;
+	if (CTB_EXPECT0(r == 0)) {
+		/* detection is idempotent so a race here is harmless */
+		cpufeatures = r = detectfeatures() | CPUFEATURES_READY;
+	}
+	return r & ~((uintxx) CPUFEATURES_READY);
+}
@@ -0,0 +1,345 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ctoolbox/fastdiv.h>
+#include <ctoolbox/cpuinfo.h>
+#include <ctoolbox/ulog2.h>
+
+#if defined(CTB_X86SIMD)
+	#include <immintrin.h>
+#endif
+
+
+/*
+ * Based on "Division by Invariant Integers using Multiplication" by Torbjorn
+ * Granlund and Peter L. Montgomery and on libdivide by ridiculous_fish.
+ */
+
+static TDivU32
+divu32gen(uint32 d, uintxx branchfree)
+{
+	TDivU32 r;
+	uint64 m;
+	uint32 rem;
+	uint32 e;
+	uint32 l;
+	CTB_ASSERT(d);
+
+	r.divisor = d;
+	l = (uint32) ctb_u32log2(d);
+	if ((d & (d - 1)) == 0) {
+		/* power of 2 */
+		r.magic = 0;
+		r.more  = l;
+		if (branchfree) {
+			r.more = (l - 1) | FASTDIV_ADD;
+		}
+		return r;
+	}
+
+	m = (((uint64) 1) << (32 + l)) / d;
+	rem = (uint32) ((((uint64) 1) << (32 + l)) - m * d);
+	e = d - rem;
+	if (branchfree == 0 && e < (((uint32) 1) << l)) {
+		/* this power works */
+		r.more = l;
+	}
+	else {
+		/* use the 33 bit magic number, computing 2^(32 + l + 1) / d */
+		m += m;
+		if (rem + rem >= d || rem + rem < rem) {
+			m++;
+		}
+		r.more = l | FASTDIV_ADD;
+	}
+	r.magic = (uint32) (m + 1);
+	return r;
+}
+
+static TDivU64
+divu64gen(uint64 d, uintxx branchfree)
+{
+	TDivU64 r;
+	uint64 m;
+	uint64 rem[1];
+	uint64 e;
+	uint32 l;
+	CTB_ASSERT(d);
+
+	r.divisor = d;
+	l = (uint32) ctb_u64log2(d);
+	if ((d & (d - 1)) == 0) {
+		/* power of 2 */
+		r.magic = 0;
+		r.more  = l;
+		if (branchfree) {
+			r.more = (l - 1) | FASTDIV_ADD;
+		}
+		return r;
+	}
+
+	m = ctb_u128divmod64(ctb_u128(((uint64) 1) << l, 0), d, rem).lo;
+	e = d - rem[0];
+	if (branchfree == 0 && e < (((uint64) 1) << l)) {
+		/* this power works */
+		r.more = l;
+	}
+	else {
+		/* use the 65 bit magic number, computing 2^(64 + l + 1) / d */
+		m += m;
+		if (rem[0] + rem[0] >= d || rem[0] + rem[0] < rem[0]) {
+			m++;
+		}
+		r.more = l | FASTDIV_ADD;
+	}
+	r.magic = m + 1;
+	return r;
+}
+
+
+TDivU32
+ctb_divu32gen(uint32 d)
+{
+	return divu32gen(d, 0);
+}
+
+TDivU64
+ctb_divu64gen(uint64 d)
+{
+	return divu64gen(d, 0);
+}
+
+TDivU32
+ctb_divu32bfgen(uint32 d)
+{
+	CTB_ASSERT(d > 1);
+	return divu32gen(d, 1);
+}
+
+TDivU64
+ctb_divu64bfgen(uint64 d)
+{
+	CTB_ASSERT(d > 1);
+	return divu64gen(d, 1);
+}
+
+
+/* ****************************************************************************
+ * Batch
+ *************************************************************************** */
+
+#if defined(CTB_X86SIMD)
+
+#if defined(__clang__)
+	#pragma clang diagnostic push
+	#pragma clang diagnostic ignored "-Wcast-align"
+#endif
+
+CTB_TARGET("avx2") static uintxx
+divu32avx2(const uint32* src, uintxx size, uint32* dst, const TDivU32* d, uintxx mod)
+{
+	uintxx j;
+	__m256i a;
+	__m256i q;
+	__m256i h;
+	__m256i m;
+	__m128i s;
+
+	m = _mm256_set1_epi32((int32) d->magic);
+	s = _mm_cvtsi32_si128((int32) (d->more & 0x1f));
+	for (j = 0; size - j >= 8; j += 8) {
+		a = _mm256_loadu_si256((const __m256i*) (src + j));
+
+		if (d->more & FASTDIV_ADD) {
+			q = _mm256_srli_epi64(_mm256_mul_epu32(a, m), 32);
+			h = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+			q = _mm256_blend_epi32(q, h, 0xaa);
+
+			h = _mm256_srli_epi32(_mm256_sub_epi32(a, q), 1);
+			q = _mm256_srl_epi32(_mm256_add_epi32(h, q), s);
+		}
+		else {
+			if (d->magic == 0) {
+				q = _mm256_srl_epi32(a, s);
+			}
+			else {
+				q = _mm256_srli_epi64(_mm256_mul_epu32(a, m), 32);
+				h = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+				q = _mm256_blend_epi32(q, h, 0xaa);
+				q = _mm256_srl_epi32(q, s);
+			}
+		}
+
+		if (mod) {
+			h = _mm256_mullo_epi32(q, _mm256_set1_epi32((int32) d->divisor));
+			q = _mm256_sub_epi32(a, h);
+		}
+		_mm256_storeu_si256((__m256i*) (dst + j), q);
+	}
+	return j;
+}
+
+/*
+ * There is no 64 bit multiplication, the products are built from 32 bit
+ * partial products. */
+CTB_TARGET("avx2") static __m256i
+mulhi64avx2(__m256i a, __m256i b)
+{
+	__m256i ah;
+	__m256i bh;
+	__m256i lolo;
+	__m256i lohi;
+	__m256i hilo;
+	__m256i hihi;
+	__m256i t;
+	__m256i w;
+
+	ah = _mm256_srli_epi64(a, 32);
+	bh = _mm256_srli_epi64(b, 32);
+	lolo = _mm256_mul_epu32(a, b);
+	lohi = _mm256_mul_epu32(a, bh);
+	hilo = _mm256_mul_epu32(ah, b);
+	hihi = _mm256_mul_epu32(ah, bh);
+
+	t = _mm256_add_epi64(hilo, _mm256_srli_epi64(lolo, 32));
+	w = _mm256_add_epi64(lohi, _mm256_and_si256(t, _mm256_set1_epi64x(0xffffffff)));
+	t = _mm256_add_epi64(hihi, _mm256_srli_epi64(t, 32));
+	return _mm256_add_epi64(t, _mm256_srli_epi64(w, 32));
+}
+
+CTB_TARGET("avx2") static __m256i
+mullo64avx2(__m256i a, __m256i b)
+{
+	__m256i c;
+
+	c = _mm256_add_epi64(
+		_mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)),
+		_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b));
+	return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(c, 32));
+}
+
+CTB_TARGET("avx2") static uintxx
+divu64avx2(const uint64* src, uintxx size, uint64* dst, const TDivU64* d, uintxx mod)
+{
+	uintxx j;
+	__m256i a;
+	__m256i q;
+	__m256i m;
+	__m128i s;
+
+	m = _mm256_set1_epi64x((int64) d->magic);
+	s = _mm_cvtsi32_si128((int32) (d->more & 0x3f));
+	for (j = 0; size - j >= 4; j += 4) {
+		a = _mm256_loadu_si256((const __m256i*) (src + j));
+
+		if (d->more & FASTDIV_ADD) {
+			q = mulhi64avx2(a, m);
+			a = _mm256_srli_epi64(_mm256_sub_epi64(a, q), 1);
+			q = _mm256_srl_epi64(_mm256_add_epi64(a, q), s);
+		}
+		else {
+			if (d->magic == 0) {
+				q = _mm256_srl_epi64(a, s);
+			}
+			else {
+				q = _mm256_srl_epi64(mulhi64avx2(a, m), s);
+			}
+		}
+
+		if (mod) {
+			a = _mm256_loadu_si256((const __m256i*) (src + j));
+			q = mullo64avx2(q, _mm256_set1_epi64x((int64) d->divisor));
+			q = _mm256_sub_epi64(a, q);
+		}
+		_mm256_storeu_si256((__m256i*) (dst + j), q);
+	}
+	return j;
+}
+
+#if defined(__clang__)
+	#pragma clang diagnostic pop
+#endif
+
+#endif
+
+
+void
+ctb_divu32batch(const uint32* src, uintxx size, uint32* dst, const TDivU32* d)
+{
+	uintxx j;
+	CTB_ASSERT((src || size == 0) && (dst || size == 0) && d);
+
+	j = 0;
+#if defined(CTB_X86SIMD)
+	if (ctb_cpufeatures() & CTB_CPU_AVX2) {
+		j = divu32avx2(src, size, dst, d, 0);
+	}
+#endif
+	for (; j < size; j++) {
+		dst[j] = ctb_divu32(src[j], d);
+	}
+}
+
+void
+ctb_modu32batch(const uint32* src, uintxx size, uint32* dst, const TDivU32* d)
+{
+	uintxx j;
+	CTB_ASSERT((src || size == 0) && (dst || size == 0) && d);
+
+	j = 0;
+#if defined(CTB_X86SIMD)
+	if (ctb_cpufeatures() & CTB_CPU_AVX2) {
+		j = divu32avx2(src, size, dst, d, 1);
+	}
+#endif
+	for (; j < size; j++) {
+		dst[j] = ctb_modu32(src[j], d);
+	}
+}
+
+void
+ctb_divu64batch(const uint64* src, uintxx size, uint64* dst, const TDivU64* d)
+{
+	uintxx j;
+	CTB_ASSERT((src || size == 0) && (dst || size == 0) && d);
+
+	j = 0;
+#if defined(CTB_X86SIMD)
+	if (ctb_cpufeatures() & CTB_CPU_AVX2) {
+		j = divu64avx2(src, size, dst, d, 0);
+	}
+#endif
+	for (; j < size; j++) {
+		dst[j] = ctb_divu64(src[j], d);
+	}
+}
+
+void
+ctb_modu64batch(const uint64* src, uintxx size, uint64* dst, const TDivU64* d)
+{
+	uintxx j;
+	CTB_ASSERT((src || size == 0) && (dst || size == 0) && d);
+
+	j = 0;
+#if defined(CTB_X86SIMD)
+	if (ctb_cpufeatures() & CTB_CPU_AVX2) {
+		j = divu64avx2(src, size, dst, d, 1);
+	}
+#endif
+	for (; j < size; j++) {
+		dst[j] = ctb_modu64(src[j], d);
+	}
+}
@@ -15,6 +15,13 @@
  */
 
 #include <ctoolbox/flt2str.h>
+#include <ctoolbox/uint128.h>
+#include <ctoolbox/ulog2.h>
+#include <ctoolbox/cpuinfo.h>
+
+#if defined(CTB_X86SIMD)
+	#include <immintrin.h>
+#endif
 
 /*
  * Based on:
@@ -26,66 +33,30 @@
 */
 
 
-/* */
-struct TVal128 {
-	uint64 hi;
-	uint64 lo;
-};
-
-CTB_INLINE struct TVal128
-mul64to128(uint64 lhs, uint64 rhs)
-{
-	struct TVal128 r;
-
-#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
-	__uint128_t product;
-
-	product = ((__uint128_t) lhs) * ((__uint128_t) rhs);
-	r.lo = (uint64) (product >> 00);
-	r.hi = (uint64) (product >> 64);
-#else
-	/*
-	 * Taken from xxHash3
-	 * See also: https://stackoverflow.com/a/58381061 */
-	uint64 loxlo;
-	uint64 loxhi;
-	uint64 hixlo;
-	uint64 hixhi;
-	uint64 upper;
-	uint64 cross;
-
-	/* first calculate all of the cross products. */
-	loxlo = (lhs & 0xffffffff) * (rhs & 0xffffffff);
-	hixlo = (lhs >> 32)        * (rhs & 0xffffffff);
-	loxhi = (lhs & 0xffffffff) * (rhs >> 32);
-	hixhi = (lhs >> 32)        * (rhs >> 32);
 
-	/* now add the products together. These will never overflow. */
-	cross = (loxlo >> 32) + (hixlo & 0xffffffff) + loxhi;
-	upper = (hixlo >> 32) + (cross >> 32)        + hixhi;
+#if defined(CTB_CFG_COMPACTTABLES)
 
-	r.hi = upper;
-	r.lo = (cross << 32) | (loxlo & 0xffffffff);
-#endif
-	return r;
-}
+static TUInt128 getpowerof10(int32 index);
 
-CTB_INLINE uint64
-mul128hi(uint64 lhs, uint64 rhs)
+CTB_INLINE TUInt128
+getgs(int32 k)
 {
-	return mul64to128(lhs, rhs).hi;
+	return getpowerof10(k - (-292));
 }
 
+#else
 
-static const struct TVal128* gtable;
+static const TUInt128* gtable;
 
-CTB_INLINE struct TVal128
+CTB_INLINE TUInt128
 getgs(int32 k)
 {
 	int32 index = (k - (-292));
 	return gtable[index];
 }
 
+#endif
+
 CTB_INLINE int32
 floorlog2pow10(int32 e) {
 	/* floor(e * log(10) div log(2)) */
@@ -130,32 +101,62 @@ setnanorinf(uint8* s, uint64 mantissa)
 	return 3;
 }
 
+/*
+ * ECMAScript names of the special values, the sign of a NaN is not shown. */
+static uintxx
+setjsnanorinf(uint8* r, uint64 mantissa, uintxx sign)
+{
+	const uint8* name;
+	uint8* s;
+
+	s = r;
+	if (mantissa) {
+		name = (const uint8*) "NaN";
+	}
+	else {
+		if (sign)
+			*s++ = '-';
+		name = (const uint8*) "Infinity";
+	}
+
+	while (name[0]) {
+		*s++ = *name++;
+	}
+	s[0] = 0x00;
+	return (uintxx) (s - r);
+}
+
 
 #define MODE_FLT64 0
 #define MODE_FLT32 1
+#define MODE_FLT16 2
+#define MODE_BF16  3
 #define FLT64_MAXDIGITS 0x11
 #define FLT32_MAXDIGITS 0x09
+#define FLT16_MAXDIGITS 0x05
+#define BF16_MAXDIGITS  0x04
 
 
 static uint8* formatG(struct TResult, uintxx, uint8*);
 static uint8* formatE(struct TResult, uintxx, uint8*, uintxx);
 static uint8* formatD(struct TResult, uint8*, uintxx);
+static uint8* formatJ(struct TResult, uint8*);
 
 
 /*
  * Float 64 */
 
 CTB_INLINE int64
-roundtoodd64(struct TVal128 g, uint64 cp)
+roundtoodd64(TUInt128 g, uint64 cp)
 {
-	struct TVal128 x;
-	struct TVal128 y;
+	TUInt128 x;
+	TUInt128 y;
 
 	/*
 	 * Computes rop(cp g 2^(-127)), where g = g1 2^63 + g0
 	 * See section 9.10 and figure 5 of [1]. */
-	x = mul64to128(g.lo, cp);
-	y = mul64to128(g.hi, cp);
+	x = ctb_mul64to128(g.lo, cp);
+	y = ctb_mul64to128(g.hi, cp);
 
 	y.lo += x.hi;
 	if (y.lo < x.hi) {
@@ -178,7 +179,7 @@ todecimal64(int32 q, uint64 c)
 	bool iseven;
 	bool win;
 	bool uin;
-	struct TVal128 g;
+	TUInt128 g;
 
 	/*
 	 * The skeleton corresponds to figure 4 of [1].
@@ -219,7 +220,7 @@ todecimal64(int32 q, uint64 c)
 		bool wpin;
 
 		/* See section 9.4 of [1]. */
-		sp = mul128hi(7378697629483820647ull, (uint64) s) >> 2;  /* s div 10 */
+		sp = ctb_mul128hi(7378697629483820647ull, (uint64) s) >> 2;  /* s div 10 */
 
 		upin = lower          <= (40 * sp);
 		wpin = (40 * sp + 40) <= upper;
@@ -267,8 +268,11 @@ schubfach64(uint64 mantissa, int32 exponent)
 	return todecimal64(exponent, mantissa);
 }
 
-uintxx
-f64tostr(flt64 number, eFLTFormatMode m, uintxx precision, uint8 r[24])
+/*
+ * Formats in all the modes but FLTF_MODEF, r must hold 26 bytes in the J
+ * mode (25 in the others). */
+static uintxx
+flt64tostr(flt64 number, eFLTFormatMode m, uintxx precision, uint8* r)
 {
 	union TBinary64 {
 		int64 i;
@@ -280,13 +284,15 @@ f64tostr(flt64 number, eFLTFormatMode m, uintxx precision, uint8 r[24])
 	uint8* s;
 	struct TResult result;
 
-	CTB_ASSERT(r);
 	f.f = number;
 	exponent = ((uint64) f.i >> 52) & 0x00000000000007ffull;
 	mantissa = ((uint64) f.i >> 00) & 0x000fffffffffffffull;
 
 	s = r;
 	if (exponent == 2047) {
+		if (m == FLTF_MODEJ) {
+			return setjsnanorinf(r, (uint64) mantissa, (uintxx) (f.i >> 63) & 1);
+		}
 		if (f.i >> 63)
 			*s++ = '-';
 		s = s + setnanorinf(s, (uint64) mantissa);
@@ -294,7 +300,7 @@ f64tostr(flt64 number, eFLTFormatMode m, uintxx precision, uint8 r[24])
 	}
 	else {
 		if (exponent == 0 && mantissa == 0) {
-			if (f.i >> 63)
+			if ((f.i >> 63) && m != FLTF_MODEJ)
 				*s++ = '-';
 			s[0] = 0x30;
 			s[1] = 0x00;
@@ -325,26 +331,44 @@ f64tostr(flt64 number, eFLTFormatMode m, uintxx precision, uint8 r[24])
 				*s++ = '-';
 			s = formatD(result, s, MODE_FLT64);
 			break;
+		case FLTF_MODEJ:
+			if (f.i >> 63)
+				*s++ = '-';
+			s = formatJ(result, s);
+			break;
+		case FLTF_MODEF:
+			break;
 	}
 
 	s[0] = 0x00;
 	return (uintxx) (s - r);
 }
 
+uintxx
+f64tostr(flt64 number, eFLTFormatMode m, uintxx precision, uint8 r[26])
+{
+	CTB_ASSERT(r);
+	if (m == FLTF_MODEF) {
+		/* the fixed notation is always exact */
+		return f64tostrn(number, m, precision, r, 26);
+	}
+	return flt64tostr(number, m, precision, r);
+}
+
 /*
  * Float 32 */
 
 CTB_INLINE int64
-roundtoodd32(struct TVal128 g, uint64 cp)
+roundtoodd32(TUInt128 g, uint64 cp)
 {
-	struct TVal128 m;
+	TUInt128 m;
 	uint32 y0;
 	uint32 y1;
 
 	/*
 	* Computes rop(cp g 2^(-95))
 	* See appendix and figure 8 of [1]. */
-	m = mul64to128(g.hi, cp);
+	m = ctb_mul64to128(g.hi, cp);
 
 	y0 = (uint32) (m.lo >> 0x20);
 	y1 = (uint32) (m.hi >> 0x00);
@@ -352,7 +376,7 @@ roundtoodd32(struct TVal128 g, uint64 cp)
 }
 
 static struct TResult
-todecimal32(int32 q, uint64 c)
+todecimal32(int32 q, uint64 c, int32 sbits, int32 qmin)
 {
 	int32 k;
 	int64 h;
@@ -365,7 +389,7 @@ todecimal32(int32 q, uint64 c)
 	bool iseven;
 	bool win;
 	bool uin;
-	struct TVal128 g;
+	TUInt128 g;
 
 	/*
 	 * The skeleton corresponds to figure 4 of [1].
@@ -373,7 +397,7 @@ todecimal32(int32 q, uint64 c)
 	iseven = (c & 0x01) == 0;
 
 	cbr = (cb = (c << 2)) + 2;
-	if ((c != (1ull << 23)) || q == -149) {
+	if ((c != (1ull << sbits)) || q == qmin) {
 		/* Regular spacing */
 		cbl = cb - 2;
 		k = floorlog10pow2(q);
@@ -407,7 +431,7 @@ todecimal32(int32 q, uint64 c)
 		bool wpin;
 
 		/* See section 9.4 of [1]. */
-		sp = mul128hi(7378697629483820647ull, s) >> 2;  /* s div 10 */
+		sp = ctb_mul128hi(7378697629483820647ull, s) >> 2;  /* s div 10 */
 
 		upin = lower          <= (40 * sp);
 		wpin = (40 * sp + 40) <= upper;
@@ -433,13 +457,16 @@ todecimal32(int32 q, uint64 c)
 	return (struct TResult) { s, k};
 }
 
+/*
+ * Also used for the 16 bit types (a flt32 has enough range and precision for
+ * them), sbits and bias are those of the type. */
 static struct TResult
-schubfach32(uint64 mantissa, int32 exponent)
+schubfach32(uint64 mantissa, int32 exponent, int32 sbits, int32 bias)
 {
 	if (exponent != 0) {
-		mantissa = mantissa | (1ull << 23);
-		exponent = exponent - 150;
-		if (0 <= -exponent && -exponent < 24) {
+		mantissa = mantissa | (1ull << sbits);
+		exponent = exponent - (bias + sbits);
+		if (0 <= -exponent && -exponent < sbits + 1) {
 			uint64 f;
 
 			f = mantissa >> -exponent;
@@ -449,9 +476,9 @@ schubfach32(uint64 mantissa, int32 exponent)
 		}
 	}
 	else {
-		exponent = -149;
+		exponent = 1 - (bias + sbits);
 	}
-	return todecimal32(exponent, mantissa);
+	return todecimal32(exponent, mantissa, sbits, 1 - (bias + sbits));
 }
 
 uintxx
@@ -469,20 +496,27 @@ f32tostr(flt32 number, eFLTFormatMode m, uintxx precision, uint8 r[24])
 	struct TResult result;
 
 	CTB_ASSERT(r);
+	if (m == FLTF_MODEF) {
+		return f64tostrn((flt64) number, m, precision, r, 24);
+	}
+
 	f.f = number;
 	exponent = ((uint32) f.i >> 23) & 0x000000ffull;
 	mantissa = ((uint32) f.i >> 00) & 0x007fffffull;
 
 	s = r;
 	if (exponent == 255) {
+		if (m == FLTF_MODEJ) {
+			return setjsnanorinf(r, (uint64) mantissa, (uintxx) (f.i >> 31) & 1);
+		}
 		if (f.i >> 31)
 			*s++ = '-';
-		s = s + setnanorinf(r, (uint64) mantissa);
+		s = s + setnanorinf(s, (uint64) mantissa);
 		return (uintxx) (s - r);
 	}
 	else {
 		if (exponent == 0 && mantissa == 0) {
-			if (f.i >> 31)
+			if ((f.i >> 31) && m != FLTF_MODEJ)
 				*s++ = '-';
 			s[0] = 0x30;
 			s[1] = 0x00;
@@ -491,7 +525,7 @@ f32tostr(flt32 number, eFLTFormatMode m, uintxx precision, uint8 r[24])
 		}
 	}
 
-	result = schubfach32((uint64) mantissa, exponent);
+	result = schubfach32((uint64) mantissa, exponent, 23, 127);
 
 	/* Ajust the precision parameter */
 	if (precision > FLT32_MAXDIGITS)
@@ -513,12 +547,155 @@ f32tostr(flt32 number, eFLTFormatMode m, uintxx precision, uint8 r[24])
 				*s++ = '-';
 			s = formatD(result, s, MODE_FLT32);
 			break;
+		case FLTF_MODEJ:
+			if (f.i >> 31)
+				*s++ = '-';
+			s = formatJ(result, s);
+			break;
+		case FLTF_MODEF:
+			break;
+	}
+
+	s[0] = 0x00;
+	return (uintxx) (s - r);
+}
+
+
+/*
+ * Float 16 and bfloat16 */
+
+/*
+ * Returns the value of a binary16 or bfloat16 (not a NaN or an infinity) as
+ * flt64, the conversion is exact. */
+static flt64
+flt16toflt64(uint32 number, uintxx mode)
+{
+	union TBinary64 {
+		uint64 u;
+		flt64  f;
+	}
+	a;
+	union TBinary64 b;
+	int32 sbits;
+	int32 ebits;
+	uint32 mantissa;
+	int32 exponent;
+
+	if (mode == MODE_FLT16) {
+		sbits = 10;
+		ebits =  5;
+	}
+	else {
+		sbits = 7;
+		ebits = 8;
+	}
+	exponent = (int32) ((number >> sbits) & ((1u << ebits) - 1));
+	mantissa = (number >> 0x00) & ((1u << sbits) - 1);
+
+	if (exponent) {
+		a.u = (uint64) (exponent - ((1 << (ebits - 1)) - 1) + 1023) << 52;
+		a.u = a.u | ((uint64) mantissa << (52 - sbits));
+	}
+	else {
+		b.u = (uint64) (1 - ((1 << (ebits - 1)) - 1) - sbits + 1023) << 52;
+		a.f = (flt64) mantissa * b.f;
+	}
+	a.u = a.u | ((uint64) (number >> 15) << 63);
+	return a.f;
+}
+
+static uintxx
+flt16tostr(uint32 number, eFLTFormatMode m, uintxx precision, uint8* r, uintxx mode)
+{
+	int32 sbits;
+	int32 ebits;
+	int32 maxdigits;
+	uint32 mantissa;
+	int32 exponent;
+	uint8* s;
+	struct TResult result;
+
+	if (mode == MODE_FLT16) {
+		sbits = 10;
+		ebits =  5;
+		maxdigits = FLT16_MAXDIGITS;
+	}
+	else {
+		sbits = 7;
+		ebits = 8;
+		maxdigits = BF16_MAXDIGITS;
+	}
+	exponent = (int32) ((number >> sbits) & ((1u << ebits) - 1));
+	mantissa = (number >> 0x00) & ((1u << sbits) - 1);
+
+	if (m == FLTF_MODEF && exponent != (1 << ebits) - 1) {
+		return f64tostrn(flt16toflt64(number, mode), m, precision, r, 24);
+	}
+
+	if (m == FLTF_MODEJ && exponent == (1 << ebits) - 1) {
+		return setjsnanorinf(r, mantissa, number >> 15);
+	}
+
+	s = r;
+	if (number >> 15)
+		*s++ = '-';
+
+	if (exponent == (1 << ebits) - 1) {
+		s = s + setnanorinf(s, mantissa);
+		return (uintxx) (s - r);
+	}
+	if (exponent == 0 && mantissa == 0) {
+		if (m == FLTF_MODEJ)
+			s = r;
+		s[0] = 0x30;
+		s[1] = 0x00;
+		s += 1;
+		return (uintxx) (s - r);
+	}
+
+	result = schubfach32(mantissa, exponent, sbits, (1 << (ebits - 1)) - 1);
+
+	/* Ajust the precision parameter */
+	if (precision > (uintxx) maxdigits)
+		precision = (uintxx) maxdigits;
+
+	switch (m) {
+		case FLTF_MODEG:
+			s = formatG(result, precision, s);
+			break;
+		case FLTF_MODEE:
+			if (precision == (uintxx) maxdigits)
+				precision--;
+			s = formatE(result, precision, s, mode);
+			break;
+		case FLTF_MODED:
+			s = formatE(result, (uintxx) maxdigits - 1, s, mode);
+			break;
+		case FLTF_MODEJ:
+			s = formatJ(result, s);
+			break;
+		case FLTF_MODEF:
+			break;
 	}
 
 	s[0] = 0x00;
 	return (uintxx) (s - r);
 }
 
+uintxx
+f16tostr(uint16 number, eFLTFormatMode m, uintxx precision, uint8 r[24])
+{
+	CTB_ASSERT(r);
+	return flt16tostr(number, m, precision, r, MODE_FLT16);
+}
+
+uintxx
+bf16tostr(uint16 number, eFLTFormatMode m, uintxx precision, uint8 r[24])
+{
+	CTB_ASSERT(r);
+	return flt16tostr(number, m, precision, r, MODE_BF16);
+}
+
 
 /* ****************************************************************************
  * Formatting
@@ -718,7 +895,8 @@ i64tostr(int64 n, union TZeroUnion* z, int32* magnitude)
 		return s2;
 	}
 
-	a = mul128hi(19342813113834068ull, (uint64) n) >> 20;
+	/* n / 10^9, exact for n < 2^57 */
+	a = ctb_mul128hi(9903520314283042200ull, (uint64) n) >> 29;
 	b = (uint64) n - (a * 1000000000u);
 
 	     todigits((uint32) b, s1 - 0);
@@ -729,6 +907,108 @@ i64tostr(int64 n, union TZeroUnion* z, int32* magnitude)
 }
 
 
+#if defined(CTB_X86SIMD)
+
+#if defined(__clang__)
+	#pragma clang diagnostic push
+	#pragma clang diagnostic ignored "-Wcast-align"
+#endif
+
+/*
+ * The digits of n < 10^8 in the 16 bit lanes: n = abcd 10^4 + efgh, each
+ * half is replicated four times and divided by 1000, 100, 10 and 1 with
+ * multiply-high (as in the SSE2 itoa of Wojciech Mula). */
+CTB_TARGET("sse2") CTB_FORCEINLINE __m128i
+eightdigitssse2(uint32 n)
+{
+	__m128i a;
+	__m128i b;
+
+	a = _mm_cvtsi32_si128((int32) n);
+	b = _mm_srli_epi64(_mm_mul_epu32(a, _mm_set1_epi32((int32) 0xd1b71759)), 45);
+	a = _mm_sub_epi32(a, _mm_mul_epu32(b, _mm_set1_epi32(10000)));
+
+	/* abcd 4 and efgh 4 in four lanes each */
+	a = _mm_slli_epi64(_mm_unpacklo_epi16(b, a), 2);
+	a = _mm_unpacklo_epi16(a, a);
+	a = _mm_unpacklo_epi32(a, a);
+
+	/* a, ab, abc, abcd, e, ef, efg, efgh */
+	a = _mm_mulhi_epu16(a, _mm_setr_epi16(
+		8389, 5243, 13108, (int16) 0x8000, 8389, 5243, 13108, (int16) 0x8000));
+	a = _mm_mulhi_epu16(a, _mm_setr_epi16(
+		 128, 2048,  8192, (int16) 0x8000,  128, 2048,  8192, (int16) 0x8000));
+
+	/* a, b, c, d, e, f, g, h */
+	b = _mm_slli_epi64(_mm_mullo_epi16(a, _mm_set1_epi16(10)), 16);
+	return _mm_sub_epi16(a, b);
+}
+
+/*
+ * Same as formatD. The 16 low digits of the significand are converted in a
+ * register, the leading zeros are found with a compare and, when there are
+ * 17 digits, they are stored directly into the output. */
+CTB_TARGET("sse2") static uint8*
+formatDsse2(struct TResult result, uint8* s, uintxx mode)
+{
+	uint64 a;
+	uint32 b;
+	uint32 c;
+	int32 magnitude;
+	uint8* pb1;
+	__m128i v;
+	__m128i zero;
+	union TZeroUnion z;
+
+	/* n / 10^8, exact for n < 2^57 */
+	a = ctb_mul128hi(48357032784585167ull, (uint64) result.mantissa) >> 18;
+	b = (uint32) ((uint64) result.mantissa - a * 100000000u);
+	c = (uint32) a / 100000000u;
+
+	zero = _mm_set1_epi8(0x30);
+	v = _mm_packus_epi16(
+		eightdigitssse2((uint32) a - c * 100000000u), eightdigitssse2(b));
+	v = _mm_add_epi8(v, zero);
+
+	if (c) {
+		s[0] = (uint8) (0x30 + c);
+		s[1] = '.';
+		_mm_storeu_si128((__m128i*) (s + 2), v);
+
+		s = appendexponent(s + 18, (int32) result.exponent + 16);
+		return s;
+	}
+
+	/* the significand has 16 - (leading zeros) digits */
+	b = (uint32) _mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)) ^ 0xffff;
+	magnitude = 16 - (int32) ctb_u32log2(b & (0 - b));
+
+	_mm_storeu_si128((__m128i*) (z.buffer + 0x04), v);
+	_mm_storeu_si128((__m128i*) (z.buffer + 0x14), zero);
+	pb1 = z.buffer + 20 - magnitude;
+
+	s[0] = pb1[0];
+	s[1] = '.';
+	if (mode == MODE_FLT64) {
+		_mm_storeu_si128((__m128i*) (s + 2), _mm_loadu_si128((__m128i*) (pb1 + 1)));
+		s += 0x12;
+	}
+	else {
+		_mm_storel_epi64((__m128i*) (s + 2), _mm_loadu_si128((__m128i*) (pb1 + 1)));
+		s += 0x0a;
+	}
+
+	s = appendexponent(s, (int32) result.exponent + (magnitude - 1));
+	return s;
+}
+
+#if defined(__clang__)
+	#pragma clang diagnostic pop
+#endif
+
+#endif
+
+
 #if defined(__clang__) && defined(CTB_FASTUNALIGNED)
 	#pragma clang diagnostic push
 	#pragma clang diagnostic ignored "-Wcast-align"
@@ -745,6 +1025,12 @@ formatD(struct TResult result, uint8* s, uintxx mode)
 	uintxx m;
 #endif
 
+#if defined(CTB_X86SIMD)
+	if (ctb_cpufeatures() & CTB_CPU_SSE2) {
+		return formatDsse2(result, s, mode);
+	}
+#endif
+
 	pb1 = i64tostr(result.mantissa, &z, &magnitude);
 	*s++ = *pb1++;
 	*s++ = '.';
@@ -951,48 +1237,981 @@ formatG(struct TResult result, uintxx precision, uint8* s)
 	return s;
 }
 
+/*
+ * Number.prototype.toString of ECMAScript 2015 (section 7.1.12.1), the
+ * shortest digits are written in fixed notation when the decimal exponent is
+ * in [-7, 21), otherwise in exponent notation without padding ("1e+21"). */
+static uint8*
+formatJ(struct TResult result, uint8* s)
+{
+	int32 k;
+	int32 n;
+	int32 j;
+	uint8* pb1;
+	uint8* end;
+	int32 magnitude;
+	union TZeroUnion z;
+
+	pb1 = i64tostr(result.mantissa, &z, &magnitude);
+	end = pb1 + magnitude;
+	while (end[-1] == 0x30) {
+		end--;
+	}
+
+	/* the value is 0.d1d2...dk 10^n */
+	k = (int32) (end - pb1);
+	n = (int32) result.exponent + magnitude;
+	if (k <= n && n <= 21) {
+		while (pb1 < end) {
+			*s++ = *pb1++;
+		}
+		for (j = n - k; j; j--) {
+			*s++ = 0x30;
+		}
+		return s;
+	}
+
+	if (0 < n && n <= 21) {
+		for (j = n; j; j--) {
+			*s++ = *pb1++;
+		}
+		*s++ = '.';
+		while (pb1 < end) {
+			*s++ = *pb1++;
+		}
+		return s;
+	}
+
+	if (-6 < n && n <= 0) {
+		*s++ = 0x30;
+		*s++ = '.';
+		for (j = -n; j; j--) {
+			*s++ = 0x30;
+		}
+		while (pb1 < end) {
+			*s++ = *pb1++;
+		}
+		return s;
+	}
+
+	*s++ = *pb1++;
+	if (pb1 < end) {
+		*s++ = '.';
+		while (pb1 < end) {
+			*s++ = *pb1++;
+		}
+	}
+
+	*s++ = 'e';
+	n = n - 1;
+	if (n < 0) {
+		*s++ = '-';
+		n = -n;
+	}
+	else {
+		*s++ = '+';
+	}
+	if (n >= 100) {
+		*s++ = (uint8) (n / 100) + 0x30;
+		n = n % 100;
+		*s++ = (uint8) (n / 10) + 0x30;
+	}
+	else {
+		if (n >= 10)
+			*s++ = (uint8) (n / 10) + 0x30;
+	}
+	*s++ = (uint8) (n % 10) + 0x30;
+	return s;
+}
 
 /* ****************************************************************************
- * Tables
+ * Exact digits (any precision)
+ *
+ * The value m 2^e is split in its integer part, converted by big integer
+ * divisions by 10^9, and its fraction, left aligned in 32 bit limbs (so the
+ * denominator is 2^(32 n)). Each multiplication of the fraction by 10^9
+ * carries the next nine digits out of the top limb. The digits are exact,
+ * the result is rounded to nearest with ties to even (like glibc).
  *************************************************************************** */
 
-/*
-* The precomputed values for g1(int) and g0(int).
-* The first entry must be for an exponent of K_MIN or less.
-* The last entry must be for an exponent of K_MAX or more. */
+/* 1074 fraction bits (1024 integer bits) plus the alignment */
+#define EXACTLIMBS 35
 
-static const struct TVal128 gtable_[] = {
-	{0xFF77B1FCBEBCDC4F, 0x25E8E89C13BB0F7B}, /* -292 */
-	{0x9FAACF3DF73609B1, 0x77B191618C54E9AD}, /* -291 */
-	{0xC795830D75038C1D, 0xD59DF5B9EF6A2418}, /* -290 */
-	{0xF97AE3D0D2446F25, 0x4B0573286B44AD1E}, /* -289 */
-	{0x9BECCE62836AC577, 0x4EE367F9430AEC33}, /* -288 */
-	{0xC2E801FB244576D5, 0x229C41F793CDA740}, /* -287 */
-	{0xF3A20279ED56D48A, 0x6B43527578C11110}, /* -286 */
-	{0x9845418C345644D6, 0x830A13896B78AAAA}, /* -285 */
-	{0xBE5691EF416BD60C, 0x23CC986BC656D554}, /* -284 */
-	{0xEDEC366B11C6CB8F, 0x2CBFBE86B7EC8AA9}, /* -283 */
-	{0x94B3A202EB1C3F39, 0x7BF7D71432F3D6AA}, /* -282 */
-	{0xB9E08A83A5E34F07, 0xDAF5CCD93FB0CC54}, /* -281 */
-	{0xE858AD248F5C22C9, 0xD1B3400F8F9CFF69}, /* -280 */
-	{0x91376C36D99995BE, 0x23100809B9C21FA2}, /* -279 */
-	{0xB58547448FFFFB2D, 0xABD40A0C2832A78B}, /* -278 */
-	{0xE2E69915B3FFF9F9, 0x16C90C8F323F516D}, /* -277 */
-	{0x8DD01FAD907FFC3B, 0xAE3DA7D97F6792E4}, /* -276 */
-	{0xB1442798F49FFB4A, 0x99CD11CFDF41779D}, /* -275 */
-	{0xDD95317F31C7FA1D, 0x40405643D711D584}, /* -274 */
-	{0x8A7D3EEF7F1CFC52, 0x482835EA666B2573}, /* -273 */
-	{0xAD1C8EAB5EE43B66, 0xDA3243650005EED0}, /* -272 */
-	{0xD863B256369D4A40, 0x90BED43E40076A83}, /* -271 */
-	{0x873E4F75E2224E68, 0x5A7744A6E804A292}, /* -270 */
-	{0xA90DE3535AAAE202, 0x711515D0A205CB37}, /* -269 */
-	{0xD3515C2831559A83, 0x0D5A5B44CA873E04}, /* -268 */
-	{0x8412D9991ED58091, 0xE858790AFE9486C3}, /* -267 */
-	{0xA5178FFF668AE0B6, 0x626E974DBE39A873}, /* -266 */
-	{0xCE5D73FF402D98E3, 0xFB0A3D212DC81290}, /* -265 */
-	{0x80FA687F881C7F8E, 0x7CE66634BC9D0B9A}, /* -264 */
-	{0xA139029F6A239F72, 0x1C1FFFC1EBC44E81}, /* -263 */
-	{0xC987434744AC874E, 0xA327FFB266B56221}, /* -262 */
+struct TExactDigits {
+	/* digits of the integer part */
+	uint8 idigits[320];
+	int32 icount;
+	int32 ipos;
+
+	/* the fraction, lo is the lowest limb not yet zero */
+	uint32 limbs[EXACTLIMBS];
+	int32 lo;
+	int32 n;
+
+	/* nine digits of the fraction */
+	uint8 chunk[9];
+	int32 cpos;
+};
+
+
+static void
+writechunk(uint32 c, uint8* s)
+{
+	uint8* p;
+
+	p = todigits(c, s + 9);
+	while (p > s) {
+		*--p = 0x30;
+	}
+}
+
+static void
+exactinit(struct TExactDigits* g, uint64 m, int32 e)
+{
+	uint32 chunks[40];
+	uint32 b[EXACTLIMBS];
+	int32 i;
+	int32 j;
+	int32 n;
+	int32 s;
+	uint64 a;
+	uint64 f;
+	uint8* p;
+
+	/* integer part as chunks of nine digits (least significant first) */
+	n = 0;
+	f = 0;
+	if (e > 11) {
+		for (i = 0; i < EXACTLIMBS; i++) {
+			b[i] = 0;
+		}
+		j = e >> 5;
+		s = e & 31;
+		b[j + 0] = (uint32) (m << s);
+		b[j + 1] = (uint32) ((m << s) >> 32);
+		b[j + 2] = (uint32) (s ? (m >> (64 - s)) : 0);
+
+		for (j = j + 2; j >= 0; ) {
+			a = 0;
+			for (i = j; i >= 0; i--) {
+				a = (a << 32) | b[i];
+				b[i] = (uint32) (a / 1000000000);
+				a = a % 1000000000;
+			}
+			chunks[n++] = (uint32) a;
+			while (j >= 0 && b[j] == 0) {
+				j--;
+			}
+		}
+	}
+	else {
+		if (e >= 0) {
+			a = m << e;
+		}
+		else {
+			a = -e < 64 ? m >> -e : 0;
+			f = -e < 64 ? m & ((1ull << -e) - 1) : m;
+		}
+		do {
+			chunks[n++] = (uint32) (a % 1000000000);
+			a = a / 1000000000;
+		} while (a);
+	}
+
+	g->ipos = 0;
+	p = todigits(chunks[n - 1], g->idigits + 10);
+	g->icount = (int32) (g->idigits + 10 - p);
+	for (i = 0; i < g->icount; i++) {
+		g->idigits[i] = p[i];
+	}
+	for (i = n - 2; i >= 0; i--) {
+		writechunk(chunks[i], g->idigits + g->icount);
+		g->icount += 9;
+	}
+
+	/* left aligned fraction */
+	g->cpos = 9;
+	g->lo = 0;
+	g->n  = 0;
+	if (f) {
+		g->n = (-e + 31) >> 5;
+		for (i = 0; i < g->n; i++) {
+			g->limbs[i] = 0;
+		}
+
+		/* f 2^(32 n + e), below 2^85, in the three lowest limbs */
+		s = (g->n << 5) + e;
+		g->limbs[0] = (uint32) (f << s);
+		if (g->n > 1)
+			g->limbs[1] = (uint32) ((f << s) >> 32);
+		if (g->n > 2 && s)
+			g->limbs[2] = (uint32) (f >> (64 - s));
+
+		while (g->limbs[g->lo] == 0) {
+			g->lo++;
+		}
+	}
+}
+
+static uint8
+nextdigit(struct TExactDigits* g)
+{
+	uint64 a;
+	int32 i;
+
+	if (g->ipos < g->icount) {
+		return g->idigits[g->ipos++];
+	}
+
+	if (g->cpos == 9) {
+		a = 0;
+		for (i = g->lo; i < g->n; i++) {
+			a = (uint64) g->limbs[i] * 1000000000 + a;
+			g->limbs[i] = (uint32) a;
+			a = a >> 32;
+		}
+		while (g->lo < g->n && g->limbs[g->lo] == 0) {
+			g->lo++;
+		}
+
+		writechunk((uint32) a, g->chunk);
+		g->cpos = 0;
+	}
+	return g->chunk[g->cpos++];
+}
+
+/*
+ * Returns 1 if there are non zero digits after the current one. */
+static uintxx
+exactsticky(struct TExactDigits* g)
+{
+	int32 i;
+
+	for (i = g->ipos; i < g->icount; i++) {
+		if (g->idigits[i] != 0x30)
+			return 1;
+	}
+	for (i = g->cpos; i < 9; i++) {
+		if (g->chunk[i] != 0x30)
+			return 1;
+	}
+	return g->lo < g->n;
+}
+
+CTB_INLINE uintxx
+exactroundup(struct TExactDigits* g, uint8 last)
+{
+	uint8 d;
+
+	d = nextdigit(g);
+	if (d != 0x35) {
+		return d > 0x35;
+	}
+	return exactsticky(g) || (last & 1);
+}
+
+static uint8*
+exactfixed(struct TExactDigits* g, uintxx precision, uint8* s)
+{
+	uint8* p;
+	uint8* q;
+
+	p = s;
+	while (g->ipos < g->icount) {
+		*p++ = g->idigits[g->ipos++];
+	}
+	if (precision) {
+		*p++ = '.';
+		for (; precision; precision--) {
+			*p++ = nextdigit(g);
+		}
+	}
+
+	if (exactroundup(g, p[-1])) {
+		for (q = p - 1; q >= s; q--) {
+			if (q[0] == '.') {
+				continue;
+			}
+			if (q[0] != 0x39) {
+				q[0]++;
+				break;
+			}
+			q[0] = 0x30;
+		}
+
+		if (q < s) {
+			/* all nines */
+			for (q = p; q > s; q--) {
+				q[0] = q[-1];
+			}
+			s[0] = 0x31;
+			p++;
+		}
+	}
+	return p;
+}
+
+static uint8*
+exactscientific(struct TExactDigits* g, uintxx precision, uint8* s)
+{
+	uint8* p;
+	uint8* q;
+	uint8 d;
+	int32 e10;
+
+	/* first significant digit */
+	e10 = g->icount - 1;
+	while ((d = nextdigit(g)) == 0x30) {
+		e10--;
+	}
+
+	p = s;
+	*p++ = d;
+	if (precision) {
+		*p++ = '.';
+		for (; precision; precision--) {
+			*p++ = nextdigit(g);
+		}
+	}
+
+	if (exactroundup(g, p[-1])) {
+		for (q = p - 1; q > s; q--) {
+			if (q[0] == '.') {
+				continue;
+			}
+			if (q[0] != 0x39) {
+				q[0]++;
+				break;
+			}
+			q[0] = 0x30;
+		}
+
+		if (q == s) {
+			if (s[0] == 0x39) {
+				s[0] = 0x31;
+				e10++;
+			}
+			else {
+				s[0]++;
+			}
+		}
+	}
+	return appendexponent(p, e10);
+}
+
+/*
+ * Returns the length of the exactfixed (or exactscientific) output without
+ * writing it, the digits are generated on a copy of g. */
+static uintxx
+exactlength(const struct TExactDigits* g, eFLTFormatMode m, uintxx precision)
+{
+	struct TExactDigits h;
+	uintxx nines;
+	uintxx j;
+	uint8 d;
+	int32 e10;
+
+	h = g[0];
+	nines = 1;
+	if (m == FLTF_MODEF) {
+		d = 0x30;
+		for (j = (uintxx) h.icount + precision; j; j--) {
+			d = nextdigit(&h);
+			if (d != 0x39)
+				nines = 0;
+		}
+
+		/* all nines rounded up take one more digit */
+		j = (uintxx) h.icount + (precision ? precision + 1 : 0);
+		if (nines && exactroundup(&h, d)) {
+			j++;
+		}
+		return j;
+	}
+
+	e10 = h.icount - 1;
+	while ((d = nextdigit(&h)) == 0x30) {
+		e10--;
+	}
+	if (d != 0x39)
+		nines = 0;
+	for (j = precision; j; j--) {
+		d = nextdigit(&h);
+		if (d != 0x39)
+			nines = 0;
+	}
+	if (nines && exactroundup(&h, d)) {
+		e10++;
+	}
+
+	j = 1 + (precision ? precision + 1 : 0);
+	if (e10 > -100 && e10 < 100) {
+		return j + 4;
+	}
+	return j + 5;
+}
+
+
+uintxx
+f64tostrsize(flt64 number, eFLTFormatMode m, uintxx precision)
+{
+	union TBinary64 {
+		uint64 u;
+		flt64  f;
+	}
+	f;
+	int32 exponent;
+
+	f.f = number;
+	exponent = (int32) ((f.u >> 52) & 0x07ff);
+	if (exponent == 2047) {
+		if (m == FLTF_MODEJ) {
+			/* "-Infinity" */
+			return 10;
+		}
+		return 5;
+	}
+
+	switch (m) {
+		case FLTF_MODEE:
+			/* sign, digit, point, precision, "e-308" and the NUL */
+			return precision + 9;
+		case FLTF_MODEF:
+			/* the integer digits (one more for the rounding) */
+			exponent = exponent - 1023;
+			if (exponent < 0) {
+				exponent = 0;
+			}
+			return (uintxx) (floorlog10pow2(exponent + 1) + 1) + precision + 4;
+		case FLTF_MODEJ:
+			/* "-0.000001" and 17 digits */
+			return 26;
+		default:
+			break;
+	}
+	return 25;
+}
+
+uintxx
+f64tostrn(flt64 number, eFLTFormatMode m, uintxx precision, uint8* r, uintxx size)
+{
+	union TBinary64 {
+		uint64 u;
+		flt64  f;
+	}
+	f;
+	uint64 mantissa;
+	int32 exponent;
+	uintxx length;
+	uintxx fits;
+	uint8* s;
+	struct TExactDigits g;
+
+	CTB_ASSERT(r);
+	if (m != FLTF_MODEE && m != FLTF_MODEF) {
+		uintxx j;
+		uintxx n;
+		uint8 buffer[32];
+
+		if (size >= f64tostrsize(number, m, precision)) {
+			return flt64tostr(number, m, precision, r);
+		}
+
+		/* the result may still fit */
+		n = flt64tostr(number, m, precision, buffer);
+		if (n >= size) {
+			if (size)
+				r[0] = 0x00;
+			return 0;
+		}
+		for (j = 0; j <= n; j++) {
+			r[j] = buffer[j];
+		}
+		return n;
+	}
+
+	/* the estimate exceeds the length by at most five bytes, when it does
+	 * not fit the exact length is computed before writing */
+	length = f64tostrsize(number, m, precision);
+	if (length > 5 && size < length - 5) {
+		goto L1;
+	}
+	fits = size >= length;
+
+	f.f = number;
+	exponent = (int32) ((f.u >> 52) & 0x07ff);
+	mantissa = (f.u >> 00) & 0x000fffffffffffffull;
+
+	length = (uintxx) (f.u >> 63);
+	if (exponent == 2047) {
+		if (fits == 0 && length + 3 >= size) {
+			goto L1;
+		}
+		s = r;
+		if (f.u >> 63)
+			*s++ = '-';
+		s = s + setnanorinf(s, mantissa);
+		return (uintxx) (s - r);
+	}
+
+	if (exponent == 0 && mantissa == 0) {
+		length += 1 + (precision ? precision + 1 : 0) + (m == FLTF_MODEE ? 4 : 0);
+		if (fits == 0 && length >= size) {
+			goto L1;
+		}
+	}
+	else {
+		if (exponent) {
+			mantissa |= 1ull << 52;
+		}
+		else {
+			exponent = 1;
+		}
+		exactinit(&g, mantissa, exponent - 1075);
+
+		if (fits == 0 && length + exactlength(&g, m, precision) >= size) {
+			goto L1;
+		}
+	}
+
+	s = r;
+	if (f.u >> 63)
+		*s++ = '-';
+
+	if (exponent == 0 && mantissa == 0) {
+		*s++ = 0x30;
+		if (precision) {
+			*s++ = '.';
+			for (; precision; precision--) {
+				*s++ = 0x30;
+			}
+		}
+		if (m == FLTF_MODEE) {
+			s = appendexponent(s, 0);
+		}
+		s[0] = 0x00;
+		return (uintxx) (s - r);
+	}
+
+	if (m == FLTF_MODEF) {
+		s = exactfixed(&g, precision, s);
+	}
+	else {
+		s = exactscientific(&g, precision, s);
+	}
+
+	s[0] = 0x00;
+	return (uintxx) (s - r);
+
+L1:
+	if (size)
+		r[0] = 0x00;
+	return 0;
+}
+
+#undef EXACTLIMBS
+
+
+/* ****************************************************************************
+ * Batch
+ *************************************************************************** */
+
+/* Size of the longest value in the G, E, D and J modes (NUL included) */
+#define BATCHMAXSIZE 26
+
+/*
+ * Converts the value i of src in any mode but FLTF_MODEF, r must hold
+ * BATCHMAXSIZE bytes. */
+static uintxx
+batchvalue(const void* src, uintxx i, eFLTFormatMode m, uintxx precision, uint8* r, uintxx mode)
+{
+	switch (mode) {
+		case MODE_FLT64:
+			return flt64tostr(((const flt64*) src)[i], m, precision, r);
+		case MODE_FLT32:
+			return f32tostr(((const flt32*) src)[i], m, precision, r);
+	}
+	return flt16tostr(((const uint16*) src)[i], m, precision, r, mode);
+}
+
+/*
+ * Stores the value i of src as flt64 (the conversion is exact), returns 0 if
+ * it is a 16 bit NaN or infinity. */
+CTB_INLINE uintxx
+batchtoflt64(const void* src, uintxx i, flt64* number, uintxx mode)
+{
+	uint32 u;
+
+	switch (mode) {
+		case MODE_FLT64:
+			number[0] = ((const flt64*) src)[i];
+			return 1;
+		case MODE_FLT32:
+			number[0] = (flt64) ((const flt32*) src)[i];
+			return 1;
+	}
+
+	u = ((const uint16*) src)[i];
+	if (mode == MODE_FLT16) {
+		if ((u & 0x7c00) == 0x7c00)
+			return 0;
+	}
+	else {
+		if ((u & 0x7f80) == 0x7f80)
+			return 0;
+	}
+	number[0] = flt16toflt64(u, mode);
+	return 1;
+}
+
+static TFltToStrBatchResult
+tostrbatch(const void* src, uintxx count, eFLTFormatMode m, uintxx precision, const uint8* separator, uint8* dst, uintxx size, uintxx* offsets, uintxx mode)
+{
+	uintxx i;
+	uintxx k;
+	uintxx n;
+	uintxx total;
+	uintxx slength;
+	uint8* s;
+	flt64 number;
+	uint8 buffer[BATCHMAXSIZE];
+
+	CTB_ASSERT(src && separator && dst);
+	for (slength = 0; separator[slength]; slength++)
+		;
+
+	total = 0;
+	for (i = 0; i < count; i++) {
+		s = dst + total;
+		if (i) {
+			s += slength;
+		}
+
+		/* the NUL must fit after the separator and the value */
+		if (size <= (uintxx) (s - dst) + 1) {
+			break;
+		}
+
+		if (m == FLTF_MODEF && batchtoflt64(src, i, &number, mode)) {
+			n = f64tostrn(number, m, precision, s, size - (uintxx) (s - dst));
+			if (n == 0) {
+				break;
+			}
+		}
+		else {
+			if (size - (uintxx) (s - dst) >= BATCHMAXSIZE) {
+				n = batchvalue(src, i, m, precision, s, mode);
+			}
+			else {
+				n = batchvalue(src, i, m, precision, buffer, mode);
+				if (n >= size - (uintxx) (s - dst)) {
+					break;
+				}
+				for (k = 0; k <= n; k++) {
+					s[k] = buffer[k];
+				}
+			}
+		}
+
+		if (i) {
+			for (k = 0; k < slength; k++) {
+				dst[total + k] = separator[k];
+			}
+		}
+		if (offsets) {
+			offsets[i] = (uintxx) (s - dst);
+		}
+		total = (uintxx) (s - dst) + n;
+	}
+
+	if (size)
+		dst[total] = 0x00;
+	return (TFltToStrBatchResult) {i, total};
+}
+
+#undef BATCHMAXSIZE
+
+TFltToStrBatchResult
+f64tostrbatch(const flt64* src, uintxx count, eFLTFormatMode m, uintxx precision, const uint8* separator, uint8* dst, uintxx size, uintxx* offsets)
+{
+	return tostrbatch(src, count, m, precision, separator, dst, size, offsets, MODE_FLT64);
+}
+
+TFltToStrBatchResult
+f32tostrbatch(const flt32* src, uintxx count, eFLTFormatMode m, uintxx precision, const uint8* separator, uint8* dst, uintxx size, uintxx* offsets)
+{
+	return tostrbatch(src, count, m, precision, separator, dst, size, offsets, MODE_FLT32);
+}
+
+TFltToStrBatchResult
+f16tostrbatch(const uint16* src, uintxx count, eFLTFormatMode m, uintxx precision, const uint8* separator, uint8* dst, uintxx size, uintxx* offsets)
+{
+	return tostrbatch(src, count, m, precision, separator, dst, size, offsets, MODE_FLT16);
+}
+
+TFltToStrBatchResult
+bf16tostrbatch(const uint16* src, uintxx count, eFLTFormatMode m, uintxx precision, const uint8* separator, uint8* dst, uintxx size, uintxx* offsets)
+{
+	return tostrbatch(src, count, m, precision, separator, dst, size, offsets, MODE_BF16);
+}
+
+
+/* ****************************************************************************
+ * Hexadecimal
+ *************************************************************************** */
+
+static const uint8 hexdigits[] = "0123456789abcdef";
+
+static uintxx
+tohexstr(uint64 mantissa, int32 exponent, uintxx sign, int32 sbits, int32 bias, uint8* r)
+{
+	uint8* s;
+	int32 i;
+	int32 n;
+	int32 e;
+	uint8 buffer[8];
+
+	s = r;
+	if (sign)
+		*s++ = '-';
+
+	if (exponent == (bias << 1) + 1) {
+		s = s + setnanorinf(s, mantissa);
+		return (uintxx) (s - r);
+	}
+
+	s[0] = '0';
+	s[1] = 'x';
+	s += 2;
+	if (exponent == 0 && mantissa == 0) {
+		*s++ = '0';
+		e = 0;
+	}
+	else {
+		if (exponent == 0) {
+			/* subnormal */
+			*s++ = '0';
+			e = 1 - bias;
+		}
+		else {
+			*s++ = '1';
+			e = exponent - bias;
+		}
+
+		if (mantissa) {
+			/* align the fraction to a whole number of nibbles */
+			n = (sbits + 3) >> 2;
+			mantissa <<= (n << 2) - sbits;
+			for (; (mantissa & 0x0f) == 0; n--) {
+				mantissa >>= 4;
+			}
+
+			*s++ = '.';
+			s += n;
+			for (i = 1; i <= n; i++) {
+				s[-i] = hexdigits[mantissa & 0x0f];
+				mantissa >>= 4;
+			}
+		}
+	}
+
+	*s++ = 'p';
+	if (e < 0) {
+		*s++ = '-';
+		e = -e;
+	}
+	else {
+		*s++ = '+';
+	}
+
+	n = 0;
+	do {
+		buffer[n++] = (uint8) (e % 10) + 0x30;
+		e /= 10;
+	} while (e);
+	while (n) {
+		*s++ = buffer[--n];
+	}
+
+	s[0] = 0x00;
+	return (uintxx) (s - r);
+}
+
+uintxx
+f64tohexstr(flt64 number, uint8 r[32])
+{
+	union TBinary64 {
+		uint64 u;
+		flt64  f;
+	}
+	f;
+	CTB_ASSERT(r);
+
+	f.f = number;
+	return tohexstr(
+		(f.u >> 00) & 0x000fffffffffffffull,
+		(int32) ((f.u >> 52) & 0x07ff), (uintxx) (f.u >> 63), 52, 1023, r);
+}
+
+uintxx
+f32tohexstr(flt32 number, uint8 r[32])
+{
+	union TBinary32 {
+		uint32 u;
+		flt32  f;
+	}
+	f;
+	CTB_ASSERT(r);
+
+	f.f = number;
+	return tohexstr(
+		(f.u >> 00) & 0x007fffff,
+		(int32) ((f.u >> 23) & 0x00ff), (uintxx) (f.u >> 31), 23, 127, r);
+}
+
+
+/* ****************************************************************************
+ * Tables
+ *************************************************************************** */
+
+#if defined(CTB_CFG_COMPACTTABLES)
+
+/*
+ * One entry of every 27, the rest are rebuilt from the stored one times a
+ * power of 5 and corrected with the error table (2 bits per entry, the error
+ * plus one), see the compressed table of str2flt.c. */
+
+#define COMPACTSTEP 27
+
+static const TUInt128 compactgtable[] = {
+	{0xFF77B1FCBEBCDC4F, 0x25E8E89C13BB0F7B}, /*  -292 */
+	{0xCE5D73FF402D98E3, 0xFB0A3D212DC81290}, /*  -265 */
+	{0xA6B34AD8C9DFC06F, 0xF42FAA48C0EA481F}, /*  -238 */
+	{0x86A8D39EF77164BC, 0xAE5DFF9C02033198}, /*  -211 */
+	{0xD98DDAEE19068C76, 0x3BADD624DD9B0958}, /*  -184 */
+	{0xAFBD2350644EEACF, 0xE5D1929EF90898FB}, /*  -157 */
+	{0x8DF5EFABC5979C8F, 0xCA8D3FFA1EF463C2}, /*  -130 */
+	{0xE55990879DDCAABD, 0xCC420A6A101D0516}, /*  -103 */
+	{0xB94470938FA89BCE, 0xF808E40E8D5B3E6A}, /*   -76 */
+	{0x95A8637627989AAD, 0xDDE7001379A44AA9}, /*   -49 */
+	{0xF1C90080BAF72CB1, 0x5324C68B12DD6339}, /*   -22 */
+	{0xC350000000000000, 0x0000000000000000}, /*     5 */
+	{0x9DC5ADA82B70B59D, 0xF020000000000000}, /*    32 */
+	{0xFEE50B7025C36A08, 0x02F236D04753D5B5}, /*    59 */
+	{0xCDE6FD5E09ABCF26, 0xED4C0226B55E6F87}, /*    86 */
+	{0xA6539930BF6BFF45, 0x84DB8346B786151D}, /*   113 */
+	{0x865B86925B9BC5C2, 0x0B8A2392BA45A9B3}, /*   140 */
+	{0xD910F7FF28069DA4, 0x1B2BA1518094DA05}, /*   167 */
+	{0xAF58416654A6BABB, 0x387AC8D1970027B3}, /*   194 */
+	{0x8DA471A9DE737E24, 0x5CEAECFED289E5D3}, /*   221 */
+	{0xE4D5E82392A40515, 0x0FABAF3FEAA5334B}, /*   248 */
+	{0xB8DA1662E7B00A17, 0x3D6A751F3B936244}, /*   275 */
+	{0x95527A5202DF0CCB, 0x0F37801E0C43EBC9}  /*   302 */
+};
+
+static const uint64 gtableerrors[] = {
+	0xA95AAA9AA965AA59ull, 0xAAAA996AAA5AA6AAull, 0x50415106A5A6AAA6ull,
+	0x5965995AA5154114ull, 0x5A559556AA565559ull, 0xA6959A96A6AAA999ull,
+	0x6AA9AA9AAA695AAAull, 0x5654516AA9AAAAAAull, 0x5665696A95556955ull,
+	0x5555555555555559ull, 0x6A55555555555555ull, 0x9A9A9665699AAAA9ull,
+	0xA59996A9AAAAA6AAull, 0x155555956965566Aull, 0xAA9A69AAA9556555ull,
+	0x5545455555865AA6ull, 0x6956AA96A9A695A4ull, 0xAA69656A695AAA66ull,
+	0x6A6A655AAAAAAAAAull, 0x000000000002AAA9ull
+};
+
+static const uint64 u64powersof5[] = {
+	0x0000000000000001ull, 0x0000000000000005ull, 0x0000000000000019ull,
+	0x000000000000007dull, 0x0000000000000271ull, 0x0000000000000c35ull,
+	0x0000000000003d09ull, 0x000000000001312dull, 0x000000000005f5e1ull,
+	0x00000000001dcd65ull, 0x00000000009502f9ull, 0x0000000002e90eddull,
+	0x000000000e8d4a51ull, 0x0000000048c27395ull, 0x000000016bcc41e9ull,
+	0x000000071afd498dull, 0x0000002386f26fc1ull, 0x000000b1a2bc2ec5ull,
+	0x000003782dace9d9ull, 0x00001158e460913dull, 0x000056bc75e2d631ull,
+	0x0001b1ae4d6e2ef5ull, 0x000878678326eac9ull, 0x002a5a058fc295edull,
+	0x00d3c21bcecceda1ull, 0x0422ca8b0a00a425ull, 0x14adf4b7320334b9ull
+};
+
+
+static TUInt128
+getpowerof10(int32 index)
+{
+	TUInt128 a;
+	TUInt128 b;
+	uint64 m;
+	uint64 e;
+	int32 r;
+	int32 lz;
+
+	r = index % COMPACTSTEP;
+	a = compactgtable[index / COMPACTSTEP];
+	if (r == 0) {
+		return a;
+	}
+
+	/* 192 bit product, the top 128 bits once normalized */
+	m = u64powersof5[r];
+	b = ctb_mul64to128(a.lo, m);
+	a = ctb_mul64to128(a.hi, m);
+	a.lo += b.hi;
+	if (a.lo < b.hi) {
+		a.hi++;
+	}
+
+#if defined(__GNUC__)
+	lz = __builtin_clzll(a.hi);
+#else
+	for (lz = 0; (a.hi << lz) >> 63 == 0; lz++) {
+	}
+#endif
+	a.hi = (a.hi << lz) | (a.lo >> (64 - lz));
+	a.lo = (a.lo << lz) | (b.lo >> (64 - lz));
+
+	e = (gtableerrors[index >> 5] >> ((index & 31) << 1)) & 3;
+	a = ctb_u128add(a, ctb_u128(0, e));
+	return ctb_u128sub(a, ctb_u128(0, 1));
+}
+
+#undef COMPACTSTEP
+
+#else
+
+/*
+* The precomputed values for g1(int) and g0(int).
+* The first entry must be for an exponent of K_MIN or less.
+* The last entry must be for an exponent of K_MAX or more. */
+
+static const TUInt128 gtable_[] = {
+	{0xFF77B1FCBEBCDC4F, 0x25E8E89C13BB0F7B}, /* -292 */
+	{0x9FAACF3DF73609B1, 0x77B191618C54E9AD}, /* -291 */
+	{0xC795830D75038C1D, 0xD59DF5B9EF6A2418}, /* -290 */
+	{0xF97AE3D0D2446F25, 0x4B0573286B44AD1E}, /* -289 */
+	{0x9BECCE62836AC577, 0x4EE367F9430AEC33}, /* -288 */
+	{0xC2E801FB244576D5, 0x229C41F793CDA740}, /* -287 */
+	{0xF3A20279ED56D48A, 0x6B43527578C11110}, /* -286 */
+	{0x9845418C345644D6, 0x830A13896B78AAAA}, /* -285 */
+	{0xBE5691EF416BD60C, 0x23CC986BC656D554}, /* -284 */
+	{0xEDEC366B11C6CB8F, 0x2CBFBE86B7EC8AA9}, /* -283 */
+	{0x94B3A202EB1C3F39, 0x7BF7D71432F3D6AA}, /* -282 */
+	{0xB9E08A83A5E34F07, 0xDAF5CCD93FB0CC54}, /* -281 */
+	{0xE858AD248F5C22C9, 0xD1B3400F8F9CFF69}, /* -280 */
+	{0x91376C36D99995BE, 0x23100809B9C21FA2}, /* -279 */
+	{0xB58547448FFFFB2D, 0xABD40A0C2832A78B}, /* -278 */
+	{0xE2E69915B3FFF9F9, 0x16C90C8F323F516D}, /* -277 */
+	{0x8DD01FAD907FFC3B, 0xAE3DA7D97F6792E4}, /* -276 */
+	{0xB1442798F49FFB4A, 0x99CD11CFDF41779D}, /* -275 */
+	{0xDD95317F31C7FA1D, 0x40405643D711D584}, /* -274 */
+	{0x8A7D3EEF7F1CFC52, 0x482835EA666B2573}, /* -273 */
+	{0xAD1C8EAB5EE43B66, 0xDA3243650005EED0}, /* -272 */
+	{0xD863B256369D4A40, 0x90BED43E40076A83}, /* -271 */
+	{0x873E4F75E2224E68, 0x5A7744A6E804A292}, /* -270 */
+	{0xA90DE3535AAAE202, 0x711515D0A205CB37}, /* -269 */
+	{0xD3515C2831559A83, 0x0D5A5B44CA873E04}, /* -268 */
+	{0x8412D9991ED58091, 0xE858790AFE9486C3}, /* -267 */
+	{0xA5178FFF668AE0B6, 0x626E974DBE39A873}, /* -266 */
+	{0xCE5D73FF402D98E3, 0xFB0A3D212DC81290}, /* -265 */
+	{0x80FA687F881C7F8E, 0x7CE66634BC9D0B9A}, /* -264 */
+	{0xA139029F6A239F72, 0x1C1FFFC1EBC44E81}, /* -263 */
+	{0xC987434744AC874E, 0xA327FFB266B56221}, /* -262 */
 	{0xFBE9141915D7A922, 0x4BF1FF9F0062BAA9}, /* -261 */
 	{0x9D71AC8FADA6C9B5, 0x6F773FC3603DB4AA}, /* -260 */
 	{0xC4CE17B399107C22, 0xCB550FB4384D21D4}, /* -259 */
@@ -1581,4 +2800,6 @@ static const struct TVal128 gtable_[] = {
 	{0x9E19DB92B4E31BA9, 0x6C07A2C26A8346D2}  /*  324 */
 };
 
-static const struct TVal128* gtable = gtable_;
+static const TUInt128* gtable = gtable_;
+
+#endif
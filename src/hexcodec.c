@@ -0,0 +1,329 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ctoolbox/hexcodec.h>
+#include <ctoolbox/cpuinfo.h>
+
+#if defined(CTB_X86SIMD)
+	#include <immintrin.h>
+#endif
+
+
+static const uint8 lowerdigits[] = "0123456789abcdef";
+static const uint8 upperdigits[] = "0123456789ABCDEF";
+
+/* 0xff for non hexadecimal characters */
+static const uint8 hexvalues[] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+
+/* ****************************************************************************
+ * Scalar kernels
+ *************************************************************************** */
+
+static void
+encodescalar(const uint8* src, uintxx size, uint8* dst, const uint8* digits)
+{
+	uint32 c;
+
+	for (; size >= 4; size -= 4) {
+		c = *src++;
+		dst[0] = digits[c >> 4];
+		dst[1] = digits[c & 15];
+		c = *src++;
+		dst[2] = digits[c >> 4];
+		dst[3] = digits[c & 15];
+		c = *src++;
+		dst[4] = digits[c >> 4];
+		dst[5] = digits[c & 15];
+		c = *src++;
+		dst[6] = digits[c >> 4];
+		dst[7] = digits[c & 15];
+		dst += 8;
+	}
+
+	for (; size; size--) {
+		c = *src++;
+		*dst++ = digits[c >> 4];
+		*dst++ = digits[c & 15];
+	}
+}
+
+static uintxx
+decodescalar(const uint8* src, uintxx size, uint8* dst)
+{
+	uint32 a;
+	uint32 b;
+	const uint8* s;
+
+	for (s = src; size >= 2; size -= 2) {
+		a = hexvalues[s[0]];
+		b = hexvalues[s[1]];
+		if (CTB_EXPECT0((a | b) & 0xf0)) {
+			break;
+		}
+
+		*dst++ = (uint8) ((a << 4) | b);
+		s += 2;
+	}
+	return (uintxx) (s - src);
+}
+
+
+/* ****************************************************************************
+ * SIMD kernels
+ *************************************************************************** */
+
+#if defined(CTB_X86SIMD)
+
+#if defined(__clang__)
+	#pragma clang diagnostic push
+	#pragma clang diagnostic ignored "-Wcast-align"
+#endif
+
+/*
+ * The nibbles are used as indices into a 16 byte table holding the digits
+ * (pshufb), the digit pairs are then interleaved back in order. */
+CTB_TARGET("ssse3") static uintxx
+encodessse3(const uint8* src, uintxx size, uint8* dst, const uint8* digits)
+{
+	uintxx j;
+	__m128i m;
+	__m128i t;
+	__m128i a;
+	__m128i h;
+	__m128i l;
+
+	t = _mm_loadu_si128((const __m128i*) digits);
+	m = _mm_set1_epi8(0x0f);
+	for (j = 0; size - j >= 16; j += 16) {
+		a = _mm_loadu_si128((const __m128i*) (src + j));
+		h = _mm_shuffle_epi8(t, _mm_and_si128(_mm_srli_epi16(a, 4), m));
+		l = _mm_shuffle_epi8(t, _mm_and_si128(a, m));
+
+		_mm_storeu_si128((__m128i*) (dst + 0x00), _mm_unpacklo_epi8(h, l));
+		_mm_storeu_si128((__m128i*) (dst + 0x10), _mm_unpackhi_epi8(h, l));
+		dst += 32;
+	}
+	return j;
+}
+
+CTB_TARGET("avx2") static uintxx
+encodeavx2(const uint8* src, uintxx size, uint8* dst, const uint8* digits)
+{
+	uintxx j;
+	__m256i m;
+	__m256i t;
+	__m256i a;
+	__m256i h;
+	__m256i l;
+
+	t = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) digits));
+	m = _mm256_set1_epi8(0x0f);
+	for (j = 0; size - j >= 32; j += 32) {
+		a = _mm256_loadu_si256((const __m256i*) (src + j));
+		h = _mm256_shuffle_epi8(t, _mm256_and_si256(_mm256_srli_epi16(a, 4), m));
+		l = _mm256_shuffle_epi8(t, _mm256_and_si256(a, m));
+
+		/* the unpack instructions work on each 128 bit lane */
+		a = _mm256_unpacklo_epi8(h, l);
+		h = _mm256_unpackhi_epi8(h, l);
+		_mm256_storeu_si256((__m256i*) (dst + 0x00), _mm256_permute2x128_si256(a, h, 0x20));
+		_mm256_storeu_si256((__m256i*) (dst + 0x20), _mm256_permute2x128_si256(a, h, 0x31));
+		dst += 64;
+	}
+	return j;
+}
+
+/*
+ * Digits and letters are classified with unsigned range checks, pairs of
+ * nibbles are merged with a multiply-add (hi * 16 + lo). Stops at the first
+ * block containing an invalid character, the caller finishes with the scalar
+ * loop. */
+CTB_TARGET("ssse3") static uintxx
+decodessse3(const uint8* src, uintxx size, uint8* dst)
+{
+	uintxx j;
+	__m128i a;
+	__m128i d;
+	__m128i l;
+	__m128i isd;
+	__m128i isl;
+
+	for (j = 0; size - j >= 16; j += 16) {
+		a = _mm_loadu_si128((const __m128i*) (src + j));
+
+		d = _mm_sub_epi8(a, _mm_set1_epi8(0x30));
+		l = _mm_sub_epi8(_mm_or_si128(a, _mm_set1_epi8(0x20)), _mm_set1_epi8(0x61));
+		isd = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+		isl = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+		if (_mm_movemask_epi8(_mm_or_si128(isd, isl)) != 0xffff) {
+			break;
+		}
+
+		l = _mm_and_si128(_mm_add_epi8(l, _mm_set1_epi8(10)), isl);
+		a = _mm_or_si128(_mm_and_si128(d, isd), l);
+		a = _mm_maddubs_epi16(a, _mm_set1_epi16(0x0110));
+		_mm_storel_epi64((__m128i*) dst, _mm_packus_epi16(a, a));
+		dst += 8;
+	}
+	return j;
+}
+
+CTB_TARGET("avx2") static uintxx
+decodeavx2(const uint8* src, uintxx size, uint8* dst)
+{
+	uintxx j;
+	__m256i a;
+	__m256i d;
+	__m256i l;
+	__m256i isd;
+	__m256i isl;
+
+	for (j = 0; size - j >= 32; j += 32) {
+		a = _mm256_loadu_si256((const __m256i*) (src + j));
+
+		d = _mm256_sub_epi8(a, _mm256_set1_epi8(0x30));
+		l = _mm256_or_si256(a, _mm256_set1_epi8(0x20));
+		l = _mm256_sub_epi8(l, _mm256_set1_epi8(0x61));
+		isd = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+		isl = _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(5)), l);
+		if (_mm256_movemask_epi8(_mm256_or_si256(isd, isl)) != -1) {
+			break;
+		}
+
+		l = _mm256_and_si256(_mm256_add_epi8(l, _mm256_set1_epi8(10)), isl);
+		a = _mm256_or_si256(_mm256_and_si256(d, isd), l);
+		a = _mm256_maddubs_epi16(a, _mm256_set1_epi16(0x0110));
+
+		/* pack works on each lane, gather the two low quadwords */
+		a = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, a), 0xd8);
+		_mm_storeu_si128((__m128i*) dst, _mm256_castsi256_si128(a));
+		dst += 16;
+	}
+	return j + decodessse3(src + j, size - j, dst);
+}
+
+#if defined(__clang__)
+	#pragma clang diagnostic pop
+#endif
+
+#endif
+
+
+uintxx
+ctb_hexencode(const uint8* src, uintxx size, uint8* dst, intxx uppercase)
+{
+	uintxx j;
+	const uint8* digits;
+	CTB_ASSERT(src && dst);
+
+	digits = lowerdigits;
+	if (uppercase) {
+		digits = upperdigits;
+	}
+
+	j = 0;
+#if defined(CTB_X86SIMD)
+	if (size >= 16) {
+		uintxx features;
+
+		features = ctb_cpufeatures();
+		if (features & CTB_CPU_AVX2) {
+			j = encodeavx2(src, size, dst, digits);
+		}
+		if (features & CTB_CPU_SSSE3) {
+			j += encodessse3(src + j, size - j, dst + (j << 1), digits);
+		}
+	}
+#endif
+
+	encodescalar(src + j, size - j, dst + (j << 1), digits);
+	return size << 1;
+}
+
+eintxx
+ctb_hexdecode(const uint8* src, uintxx size, uint8* dst, const uint8** end)
+{
+	uintxx j;
+	uintxx n;
+	CTB_ASSERT(src && dst);
+
+	j = 0;
+#if defined(CTB_X86SIMD)
+	if (size >= 16) {
+		uintxx features;
+
+		features = ctb_cpufeatures();
+		if (features & CTB_CPU_AVX2) {
+			j = decodeavx2(src, size, dst);
+		}
+		else {
+			if (features & CTB_CPU_SSSE3) {
+				j = decodessse3(src, size, dst);
+			}
+		}
+	}
+#endif
+
+	n = size & ~((uintxx) 1);
+	j += decodescalar(src + j, n - j, dst + (j >> 1));
+	if (end)
+		end[0] = src + j;
+
+	if (CTB_EXPECT0(j != n)) {
+		return HEXCODEC_EINPUT;
+	}
+	if (CTB_EXPECT0(n != size)) {
+		if (hexvalues[src[n]] & 0xf0) {
+			return HEXCODEC_EINPUT;
+		}
+		return HEXCODEC_ESIZE;
+	}
+	return HEXCODEC_OK;
+}
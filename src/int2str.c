@@ -15,6 +15,8 @@
 */
 
 #include <ctoolbox/int2str.h>
+#include <ctoolbox/uint128.h>
+#include <ctoolbox/ulog2.h>
 
 
 static const uint8 radix100[] = {
@@ -71,56 +73,6 @@ todigits(uint32 number, uint8* buffer)
 }
 
 
-/* */
-struct TVal128 {
-	uint64 hi;
-	uint64 lo;
-};
-
-CTB_INLINE struct TVal128
-mul64to128(uint64 lhs, uint64 rhs)
-{
-	struct TVal128 r;
-
-#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
-	__uint128_t product;
-
-	product = ((__uint128_t) lhs) * ((__uint128_t) rhs);
-	r.lo = (uint64) (product >> 00);
-	r.hi = (uint64) (product >> 64);
-#else
-	/*
-	 * Taken from xxHash3
-	 * See also: https://stackoverflow.com/a/58381061 */
-	uint64 loxlo;
-	uint64 loxhi;
-	uint64 hixlo;
-	uint64 hixhi;
-	uint64 upper;
-	uint64 cross;
-
-	/* first calculate all of the cross products. */
-	loxlo = (lhs & 0xffffffff) * (rhs & 0xffffffff);
-	hixlo = (lhs >> 32)        * (rhs & 0xffffffff);
-	loxhi = (lhs & 0xffffffff) * (rhs >> 32);
-	hixhi = (lhs >> 32)        * (rhs >> 32);
-
-	/* now add the products together. These will never overflow. */
-	cross = (loxlo >> 32) + (hixlo & 0xffffffff) + loxhi;
-	upper = (hixlo >> 32) + (cross >> 32)        + hixhi;
-
-	r.hi = upper;
-	r.lo = (cross << 32) | (loxlo & 0xffffffff);
-#endif
-	return r;
-}
-
-CTB_INLINE uint64
-mul128hi(uint64 lhs, uint64 rhs)
-{
-	return mul64to128(lhs, rhs).hi;
-}
-
 /* */
 #if defined(CTB_ENV64)
 
@@ -173,7 +125,7 @@ u32tostr(uint32 number, uint8 r[16])
 		uint64 a;
 		uint64 b;
 
-		a = mul128hi(19342813113834068ull, number) >> 20;
+		a = ctb_mul128hi(19342813113834068ull, number) >> 20;
 		b = number - (a * 1000000000);
 
 		     todigits((uint32) b, s1 - 0);
@@ -244,13 +196,13 @@ u64tostr(uint64 number, uint8 r[24])
 		uint64 b;
 		uint64 c;
 
-		a = mul128hi(19342813113834067ull, number >> 9) >> 11;
+		a = ctb_mul128hi(19342813113834067ull, number >> 9) >> 11;
 		b = number - (a * 1000000000ull);
 		if (a > 1000000000ull) {
 			number = a;
 			c = b;
 
-			a = mul128hi(19342813113834067ull, number >> 9) >> 11;
+			a = ctb_mul128hi(19342813113834067ull, number >> 9) >> 11;
 			b = number - (a * 1000000000ull);
 
 			     todigits((uint32) c, s1 - 9 * 0);
@@ -349,6 +301,290 @@ i64tostr(int64 number, uint8 r[24])
 #endif
 
 
+/*
+ * Writes exactly 19 digits (zero padded) starting at buffer. */
+static void
+todigits19(uint64 number, uint8* buffer)
+{
+	uint64 a;
+	uint64 b;
+	uintxx j;
+
+	for (j = 0; j < 19; j++) {
+		buffer[j] = 0x30;
+	}
+
+	a = number / 1000000000;
+	b = a / 1000000000;
+	todigits((uint32) (number - (a * 1000000000)), buffer + 19);
+	todigits((uint32) (a      - (b * 1000000000)), buffer + 10);
+	buffer[0] = (uint8) (0x30 + b);
+}
+
+uintxx
+u128tostr(TUInt128 number, uint8 r[40])
+{
+	uint8* s;
+	uint64 a[1];
+	uint64 b[1];
+	CTB_ASSERT(r);
+
+	if (number.hi == 0) {
+		return u64tostr(number.lo, r);
+	}
+
+	/* split in groups of 19 digits */
+	number = ctb_u128divmod64(number, 10000000000000000000ull, a);
+	if (number.hi == 0) {
+		s = r + u64tostr(number.lo, r);
+	}
+	else {
+		number = ctb_u128divmod64(number, 10000000000000000000ull, b);
+
+		s = r;
+		*s++ = (uint8) (0x30 + number.lo);
+		todigits19(b[0], s);
+		s += 19;
+	}
+	todigits19(a[0], s);
+	s += 19;
+
+	s[0] = 0x00;
+	return (uintxx) (s - r);
+}
+
+
+/* ****************************************************************************
+ * Formatted output
+ *************************************************************************** */
+
+static const uint64 powersof10[] = {
+	1ull,
+	10ull,
+	100ull,
+	1000ull,
+	10000ull,
+	100000ull,
+	1000000ull,
+	10000000ull,
+	100000000ull,
+	1000000000ull,
+	10000000000ull,
+	100000000000ull,
+	1000000000000ull,
+	10000000000000ull,
+	100000000000000ull,
+	1000000000000000ull,
+	10000000000000000ull,
+	100000000000000000ull,
+	1000000000000000000ull,
+	10000000000000000000ull
+};
+
+CTB_INLINE uintxx
+countdigits(uint64 number)
+{
+	uintxx t;
+
+	/* approximation of log10 from log2 (1233 / 4096 = log10(2)) */
+	t = ((ctb_u64log2(number | 1) + 1) * 1233) >> 12;
+	t = t + (number >= powersof10[t]);
+	if (t == 0) {
+		return 1;
+	}
+	return t;
+}
+
+/*
+ * Writes the digits backwards, p points past the last digit. */
+static void
+writedigits(uint64 number, uint8* p)
+{
+	uint64 n;
+	uint32 r;
+
+	/* todigits is exact for numbers below 10^9 */
+	for (; number >= 1000000000; number = n) {
+		n = number / 100;
+		r = (uint32) (number - (n * 100));
+		p -= 2;
+		p[0] = radix100[(r << 1) + 0];
+		p[1] = radix100[(r << 1) + 1];
+	}
+	todigits((uint32) number, p);
+}
+
+static void
+writegrouped(uint64 number, uint8* p, uint8 separator)
+{
+	uint64 n;
+	uint32 r;
+	uint32 m;
+
+	for (; number >= 1000; number = n) {
+		n = number / 1000;
+		r = (uint32) (number - (n * 1000));
+		m = r / 100;
+		r = r - (m * 100);
+		p -= 4;
+		p[0] = separator;
+		p[1] = (uint8) (0x30 + m);
+		p[2] = radix100[(r << 1) + 0];
+		p[3] = radix100[(r << 1) + 1];
+	}
+	todigits((uint32) number, p);
+}
+
+static uintxx
+formatu64(uint64 number, uintxx negative, uintxx flags, uintxx width, uint8 separator, uint8* r)
+{
+	uintxx digits;
+	uintxx total;
+	uintxx pad;
+	uintxx j;
+	uint8* s;
+
+	digits = countdigits(number);
+	if (flags & INTF_GROUPING) {
+		if (separator == 0) {
+			separator = 0x2c;
+		}
+		digits += (digits - 1) / 3;
+	}
+
+	pad = 0;
+	total = digits + negative;
+	if (width > total) {
+		pad = width - total;
+	}
+
+	s = r;
+	if ((flags & (INTF_ZEROPAD | INTF_LEFTALIGN)) == INTF_ZEROPAD) {
+		if (negative) {
+			*s++ = 0x2d;
+		}
+		for (j = 0; j < pad; j++) {
+			*s++ = 0x30;
+		}
+		pad = 0;
+	}
+	else {
+		if ((flags & INTF_LEFTALIGN) == 0) {
+			for (j = 0; j < pad; j++) {
+				*s++ = 0x20;
+			}
+			pad = 0;
+		}
+		if (negative) {
+			*s++ = 0x2d;
+		}
+	}
+
+	s += digits;
+	if (flags & INTF_GROUPING) {
+		writegrouped(number, s, separator);
+	}
+	else {
+		writedigits(number, s);
+	}
+
+	/* left aligned */
+	for (j = 0; j < pad; j++) {
+		*s++ = 0x20;
+	}
+	s[0] = 0x00;
+	return (uintxx) (s - r);
+}
+
+uintxx
+u32tostrf(uint32 number, uintxx flags, uintxx width, uint8 separator, uint8* r)
+{
+	CTB_ASSERT(r);
+
+	return formatu64(number, 0, flags, width, separator, r);
+}
+
+uintxx
+i32tostrf(int32 number, uintxx flags, uintxx width, uint8 separator, uint8* r)
+{
+	CTB_ASSERT(r);
+
+	if (number < 0) {
+		return formatu64(0 - (uint32) number, 1, flags, width, separator, r);
+	}
+	return formatu64((uint32) number, 0, flags, width, separator, r);
+}
+
+uintxx
+u64tostrf(uint64 number, uintxx flags, uintxx width, uint8 separator, uint8* r)
+{
+	CTB_ASSERT(r);
+
+	return formatu64(number, 0, flags, width, separator, r);
+}
+
+uintxx
+i64tostrf(int64 number, uintxx flags, uintxx width, uint8 separator, uint8* r)
+{
+	CTB_ASSERT(r);
+
+	if (number < 0) {
+		return formatu64(0 - (uint64) number, 1, flags, width, separator, r);
+	}
+	return formatu64((uint64) number, 0, flags, width, separator, r);
+}
+
+
+/* ****************************************************************************
+ * Fixed point output
+ *************************************************************************** */
+
+uintxx
+i64toscaledstr(int64 number, uintxx scale, uint8 r[24])
+{
+	uintxx digits;
+	uintxx j;
+	uint64 u;
+	uint8* s;
+	CTB_ASSERT(r && scale <= 19);
+
+	s = r;
+	u = (uint64) number;
+	if (number < 0) {
+		u = 0 - u;
+		*s++ = 0x2d;
+	}
+
+	digits = countdigits(u);
+	if (digits <= scale) {
+		*s++ = 0x30;
+		*s++ = 0x2e;
+		for (j = digits; j < scale; j++) {
+			*s++ = 0x30;
+		}
+		s += digits;
+		writedigits(u, s);
+	}
+	else {
+		s += digits;
+		writedigits(u, s);
+
+		/* move the fractional digits to make room for the point */
+		if (scale) {
+			for (j = 0; j < scale; j++) {
+				s[0] = s[-1];
+				s--;
+			}
+			s[0] = 0x2e;
+			s += scale + 1;
+		}
+	}
+
+	s[0] = 0x00;
+	return (uintxx) (s - r);
+}
+
+
 uintxx
 u32tohexa(uint32 number, intxx uppercase, uint8 r[16])
 {
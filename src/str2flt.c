@@ -15,11 +15,15 @@
  */
 
 #include <ctoolbox/str2flt.h>
+#include <ctoolbox/uint128.h>
 #include <ctoolbox/ctype.h>
+#include <float.h>
 
 
 #define FLT32MODE 0
 #define FLT64MODE 1
+#define FLT16MODE 2
+#define BF16MODE  3
 
 /* Float type parameters */
 struct TFLTType {
@@ -30,25 +34,32 @@ struct TFLTType {
 
 	int32 minexponentroundtoeven;
 	int32 maxexponentroundtoeven;
+
+	/* digits that can change the rounding */
+	int32 maxdigits;
 };
 
 
 #define FLT32EXPBITS  8
 #define FLT64EXPBITS 11
+#define FLT16EXPBITS  5
+#define BF16EXPBITS   8
 
 static const struct TFLTType flttype[] = {
-	{23, FLT32EXPBITS,  -127, (1l << FLT32EXPBITS) - 1, -17, 23},  /* flt32 */
-	{52, FLT64EXPBITS, -1023, (1l << FLT64EXPBITS) - 1,  -4, 23}   /* flt64 */
+	{23, FLT32EXPBITS,  -127, (1l << FLT32EXPBITS) - 1, -17, 23, 114},  /* flt32 */
+	{52, FLT64EXPBITS, -1023, (1l << FLT64EXPBITS) - 1,  -4, 23, 769},  /* flt64 */
+	{10, FLT16EXPBITS,   -15, (1l << FLT16EXPBITS) - 1, -26,  5,  22},  /* flt16 */
+	{ 7,  BF16EXPBITS,  -127, (1l <<  BF16EXPBITS) - 1, -24,  3,  98}   /* bf16  */
 };
 
 
 #define FLTINF(MB, EB) (((1ull << ((EB) + 0)) - 1) << (MB))
-#define FLTNAN(MB, EB) (((1ull << ((EB) + 1)) - 1) << (MB))
+#define FLTNAN(MB, EB) (FLTINF(MB, EB) | (1ull << ((MB) - 1)))
 
 #define FLT32INF FLTINF(23,  8)
 #define FLT32NAN FLTNAN(23,  8)
 #define FLT64INF FLTINF(52, 11)
-#define FLT64NAN FLTINF(52, 11)
+#define FLT64NAN FLTNAN(52, 11)
 
 
 /* */
@@ -58,549 +69,6 @@ struct TFltResult {
 };
 
 
-/* ****************************************************************************
- * Simple decimal conversion ported from Golang decimal conversion
- * go/src/strconv/decimal.go
- * Using some optimizations from Wuff implementation:
- * https://github.com/google/wuffs/pull/87
- *
- * See also:
- * https://nigeltao.github.io/blog/2020/parse-number-f64-simple.html
- *************************************************************************** */
-
-/* Mutiprecision decimal number */
-struct TDecimal {
-	int32 decimalpoint;
-	int32 overflow;
-	int32 n;
-
-	/* Big-enddian representation */
-	uint8 digits[800];
-};
-
-/* Maximum shift that we can do in one pass without overflow */
-#define DECIMALMAXLSHIFT (32 - 6)
-#define DECIMALMAXRSHIFT (64 - 4)
-
-
-static void
-decimaltrim(struct TDecimal* decimal)
-{
-	int32 j;
-
-	for (j = decimal->n - 1; j; j--) {
-		if (decimal->digits[j]) {
-			break;
-		}
-	}
-	decimal->n = j + 1;
-}
-
-static void
-decimalrshift(struct TDecimal* decimal, uintxx amount)
-{
-	uint64 n;
-	uint64 m;
-	int32 r;
-	int32 w;
-
-	r = 0;
-	w = 0;
-	n = 0;
-	while ((n >> amount) == 0) {
-		if (r >= decimal->n) {
-			if (n == 0) {
-				decimal->n = 0;
-				return;
-			}
-			while ((n >> amount) == 0) {
-				n = n * 10;
-				r++;
-			}
-			break;
-		}
-		n = n * 10 + decimal->digits[r++];
-	}
-	decimal->decimalpoint -= r - 1;
-
-	m = (((uint64) 1) << amount) - 1;
-	while (r < decimal->n) {
-		uint32 c;
-
-		c = decimal->digits[r++];
-		decimal->digits[w++] = (uint8) (n >> amount);
-		n = ((n & m) * 10) + c;
-	}
-
-	while (n) {
-		if ((uint32) w < sizeof(decimal->digits)) {
-			decimal->digits[w++] = (uint8) (n >> amount);
-		}
-		else {
-			if (n >> amount) {
-				decimal->overflow = 1;
-			}
-		}
-		n = (n & m) * 10;
-	}
-
-	decimal->n = w;
-	decimaltrim(decimal);
-}
-
-
-static const int32 lscheat[] = {
-	0x00000001, 0x00020101,
-	0x00060102, 0x00080103,
-	0x000e0203, 0x00120204,
-	0x00180205, 0x001e0305,
-	0x00260306, 0x002c0307,
-	0x00360407, 0x003e0408,
-	0x00480409, 0x0052040a,
-	0x005c050a, 0x0068050b,
-	0x0076050c, 0x0084060c,
-	0x0090060d, 0x009e060e,
-	0x00ac070e, 0x00bc070f,
-	0x00ce0710, 0x00e00711,
-	0x00f20811, 0x01060812,
-	0x01180813, 0x012e0913,
-	0x01420914, 0x01580915,
-	0x016e0a15, 0x01860a16,
-	0x019c0a17, 0x01b60a18,
-	0x01d00b18, 0x01e80b19,
-	0x02020b1a, 0x021c0c1a,
-	0x02380c1b, 0x02560c1c,
-	0x02740d1c, 0x02900d1d,
-	0x02ae0d1e, 0x02cc0d1f,
-	0x02ee0e1f, 0x030e0e20,
-	0x03300e21, 0x03520f21,
-	0x03760f22, 0x03980f23,
-	0x03be1023, 0x03e21024,
-	0x04081025, 0x042e1026,
-	0x04541126, 0x047c1127,
-	0x04a61128, 0x04d01228,
-	0x04f81229, 0x0522122a,
-	0x054c132a
-};
-
-static const uint8 lscheatdigits[] = {
-	1, 0, 5, 0, 0, 0, 2, 5, 1, 2, 5, 0, 0, 0, 6, 2,
-	5, 0, 3, 1, 2, 5, 0, 0, 1, 5, 6, 2, 5, 0, 7, 8,
-	1, 2, 5, 0, 0, 0, 3, 9, 0, 6, 2, 5, 1, 9, 5, 3,
-	1, 2, 5, 0, 0, 0, 9, 7, 6, 5, 6, 2, 5, 0, 4, 8,
-	8, 2, 8, 1, 2, 5, 0, 0, 2, 4, 4, 1, 4, 0, 6, 2,
-	5, 0, 1, 2, 2, 0, 7, 0, 3, 1, 2, 5, 6, 1, 0, 3,
-	5, 1, 5, 6, 2, 5, 0, 0, 3, 0, 5, 1, 7, 5, 7, 8,
-	1, 2, 5, 0, 0, 0, 1, 5, 2, 5, 8, 7, 8, 9, 0, 6,
-	2, 5, 0, 0, 7, 6, 2, 9, 3, 9, 4, 5, 3, 1, 2, 5,
-	3, 8, 1, 4, 6, 9, 7, 2, 6, 5, 6, 2, 5, 0, 1, 9,
-	0, 7, 3, 4, 8, 6, 3, 2, 8, 1, 2, 5, 9, 5, 3, 6,
-	7, 4, 3, 1, 6, 4, 0, 6, 2, 5, 0, 0, 4, 7, 6, 8,
-	3, 7, 1, 5, 8, 2, 0, 3, 1, 2, 5, 0, 0, 0, 2, 3,
-	8, 4, 1, 8, 5, 7, 9, 1, 0, 1, 5, 6, 2, 5, 0, 0,
-	1, 1, 9, 2, 0, 9, 2, 8, 9, 5, 5, 0, 7, 8, 1, 2,
-	5, 0, 5, 9, 6, 0, 4, 6, 4, 4, 7, 7, 5, 3, 9, 0,
-	6, 2, 5, 0, 0, 0, 2, 9, 8, 0, 2, 3, 2, 2, 3, 8,
-	7, 6, 9, 5, 3, 1, 2, 5, 1, 4, 9, 0, 1, 1, 6, 1,
-	1, 9, 3, 8, 4, 7, 6, 5, 6, 2, 5, 0, 0, 0, 7, 4,
-	5, 0, 5, 8, 0, 5, 9, 6, 9, 2, 3, 8, 2, 8, 1, 2,
-	5, 0, 3, 7, 2, 5, 2, 9, 0, 2, 9, 8, 4, 6, 1, 9,
-	1, 4, 0, 6, 2, 5, 0, 0, 1, 8, 6, 2, 6, 4, 5, 1,
-	4, 9, 2, 3, 0, 9, 5, 7, 0, 3, 1, 2, 5, 0, 9, 3,
-	1, 3, 2, 2, 5, 7, 4, 6, 1, 5, 4, 7, 8, 5, 1, 5,
-	6, 2, 5, 0, 0, 0, 4, 6, 5, 6, 6, 1, 2, 8, 7, 3,
-	0, 7, 7, 3, 9, 2, 5, 7, 8, 1, 2, 5, 2, 3, 2, 8,
-	3, 0, 6, 4, 3, 6, 5, 3, 8, 6, 9, 6, 2, 8, 9, 0,
-	6, 2, 5, 0, 0, 0, 1, 1, 6, 4, 1, 5, 3, 2, 1, 8,
-	2, 6, 9, 3, 4, 8, 1, 4, 4, 5, 3, 1, 2, 5, 0, 0,
-	5, 8, 2, 0, 7, 6, 6, 0, 9, 1, 3, 4, 6, 7, 4, 0,
-	7, 2, 2, 6, 5, 6, 2, 5, 2, 9, 1, 0, 3, 8, 3, 0,
-	4, 5, 6, 7, 3, 3, 7, 0, 3, 6, 1, 3, 2, 8, 1, 2,
-	5, 0, 1, 4, 5, 5, 1, 9, 1, 5, 2, 2, 8, 3, 6, 6,
-	8, 5, 1, 8, 0, 6, 6, 4, 0, 6, 2, 5, 7, 2, 7, 5,
-	9, 5, 7, 6, 1, 4, 1, 8, 3, 4, 2, 5, 9, 0, 3, 3,
-	2, 0, 3, 1, 2, 5, 0, 0, 3, 6, 3, 7, 9, 7, 8, 8,
-	0, 7, 0, 9, 1, 7, 1, 2, 9, 5, 1, 6, 6, 0, 1, 5,
-	6, 2, 5, 0, 0, 0, 1, 8, 1, 8, 9, 8, 9, 4, 0, 3,
-	5, 4, 5, 8, 5, 6, 4, 7, 5, 8, 3, 0, 0, 7, 8, 1,
-	2, 5, 0, 0, 9, 0, 9, 4, 9, 4, 7, 0, 1, 7, 7, 2,
-	9, 2, 8, 2, 3, 7, 9, 1, 5, 0, 3, 9, 0, 6, 2, 5,
-	4, 5, 4, 7, 4, 7, 3, 5, 0, 8, 8, 6, 4, 6, 4, 1,
-	1, 8, 9, 5, 7, 5, 1, 9, 5, 3, 1, 2, 5, 0, 2, 2,
-	7, 3, 7, 3, 6, 7, 5, 4, 4, 3, 2, 3, 2, 0, 5, 9,
-	4, 7, 8, 7, 5, 9, 7, 6, 5, 6, 2, 5, 1, 1, 3, 6,
-	8, 6, 8, 3, 7, 7, 2, 1, 6, 1, 6, 0, 2, 9, 7, 3,
-	9, 3, 7, 9, 8, 8, 2, 8, 1, 2, 5, 0, 0, 0, 5, 6,
-	8, 4, 3, 4, 1, 8, 8, 6, 0, 8, 0, 8, 0, 1, 4, 8,
-	6, 9, 6, 8, 9, 9, 4, 1, 4, 0, 6, 2, 5, 0, 2, 8,
-	4, 2, 1, 7, 0, 9, 4, 3, 0, 4, 0, 4, 0, 0, 7, 4,
-	3, 4, 8, 4, 4, 9, 7, 0, 7, 0, 3, 1, 2, 5, 0, 0,
-	1, 4, 2, 1, 0, 8, 5, 4, 7, 1, 5, 2, 0, 2, 0, 0,
-	3, 7, 1, 7, 4, 2, 2, 4, 8, 5, 3, 5, 1, 5, 6, 2,
-	5, 0, 7, 1, 0, 5, 4, 2, 7, 3, 5, 7, 6, 0, 1, 0,
-	0, 1, 8, 5, 8, 7, 1, 1, 2, 4, 2, 6, 7, 5, 7, 8,
-	1, 2, 5, 0, 0, 0, 3, 5, 5, 2, 7, 1, 3, 6, 7, 8,
-	8, 0, 0, 5, 0, 0, 9, 2, 9, 3, 5, 5, 6, 2, 1, 3,
-	3, 7, 8, 9, 0, 6, 2, 5, 1, 7, 7, 6, 3, 5, 6, 8,
-	3, 9, 4, 0, 0, 2, 5, 0, 4, 6, 4, 6, 7, 7, 8, 1,
-	0, 6, 6, 8, 9, 4, 5, 3, 1, 2, 5, 0, 0, 0, 8, 8,
-	8, 1, 7, 8, 4, 1, 9, 7, 0, 0, 1, 2, 5, 2, 3, 2,
-	3, 3, 8, 9, 0, 5, 3, 3, 4, 4, 7, 2, 6, 5, 6, 2,
-	5, 0, 4, 4, 4, 0, 8, 9, 2, 0, 9, 8, 5, 0, 0, 6,
-	2, 6, 1, 6, 1, 6, 9, 4, 5, 2, 6, 6, 7, 2, 3, 6,
-	3, 2, 8, 1, 2, 5, 0, 0, 2, 2, 2, 0, 4, 4, 6, 0,
-	4, 9, 2, 5, 0, 3, 1, 3, 0, 8, 0, 8, 4, 7, 2, 6,
-	3, 3, 3, 6, 1, 8, 1, 6, 4, 0, 6, 2, 5, 0, 1, 1,
-	1, 0, 2, 2, 3, 0, 2, 4, 6, 2, 5, 1, 5, 6, 5, 4,
-	0, 4, 2, 3, 6, 3, 1, 6, 6, 8, 0, 9, 0, 8, 2, 0,
-	3, 1, 2, 5, 5, 5, 5, 1, 1, 1, 5, 1, 2, 3, 1, 2,
-	5, 7, 8, 2, 7, 0, 2, 1, 1, 8, 1, 5, 8, 3, 4, 0,
-	4, 5, 4, 1, 0, 1, 5, 6, 2, 5, 0, 0, 2, 7, 7, 5,
-	5, 5, 7, 5, 6, 1, 5, 6, 2, 8, 9, 1, 3, 5, 1, 0,
-	5, 9, 0, 7, 9, 1, 7, 0, 2, 2, 7, 0, 5, 0, 7, 8,
-	1, 2, 5, 0, 0, 0, 1, 3, 8, 7, 7, 7, 8, 7, 8, 0,
-	7, 8, 1, 4, 4, 5, 6, 7, 5, 5, 2, 9, 5, 3, 9, 5,
-	8, 5, 1, 1, 3, 5, 2, 5, 3, 9, 0, 6, 2, 5, 0, 0,
-	6, 9, 3, 8, 8, 9, 3, 9, 0, 3, 9, 0, 7, 2, 2, 8,
-	3, 7, 7, 6, 4, 7, 6, 9, 7, 9, 2, 5, 5, 6, 7, 6,
-	2, 6, 9, 5, 3, 1, 2, 5, 3, 4, 6, 9, 4, 4, 6, 9,
-	5, 1, 9, 5, 3, 6, 1, 4, 1, 8, 8, 8, 2, 3, 8, 4,
-	8, 9, 6, 2, 7, 8, 3, 8, 1, 3, 4, 7, 6, 5, 6, 2,
-	5, 0, 1, 7, 3, 4, 7, 2, 3, 4, 7, 5, 9, 7, 6, 8,
-	0, 7, 0, 9, 4, 4, 1, 1, 9, 2, 4, 4, 8, 1, 3, 9,
-	1, 9, 0, 6, 7, 3, 8, 2, 8, 1, 2, 5, 8, 6, 7, 3,
-	6, 1, 7, 3, 7, 9, 8, 8, 4, 0, 3, 5, 4, 7, 2, 0,
-	5, 9, 6, 2, 2, 4, 0, 6, 9, 5, 9, 5, 3, 3, 6, 9,
-	1, 4, 0, 6, 2, 5, 0, 0
-};
-
-static int32
-getdigitsdelta(struct TDecimal* decimal, uintxx amount)
-{
-	int32 j;
-	int32 count;
-	int32 delta;
-	const uint8* ldgts;
-
-	j = lscheat[amount];
-	count = (j >> 0x00) & 0xff;
-	delta = (j >> 0x08) & 0xff;
-	ldgts = lscheatdigits + (j >> 0x10);
-
-	for (j = 0; j < count; j++) {
-		if (j >= decimal->n) {
-			delta--;
-			break;
-		}
-		if (decimal->digits[j] ^ ldgts[j]) {
-			delta -= (decimal->digits[j] < ldgts[j]);
-			break;
-		}
-	}
-	return delta;
-}
-
-static void
-decimallshift(struct TDecimal* decimal, uintxx amount)
-{
-	int32 r;
-	int32 w;
-	int32 delta;
-	uint64 n;
-	uint64 quotient;
-	uint64 remainder;
-
-	delta = getdigitsdelta(decimal, amount);
-	r = decimal->n - 1;
-	w = decimal->n + delta;
-
-	n = 0;
-	while (r >= 0) {
-		n += ((uint64) decimal->digits[r--]) << amount;
-		remainder = n - ((quotient = (n * 429496730) >> 32) * 10);
-		w--;
-		if (w < (int32) sizeof(decimal->digits)) {
-			decimal->digits[w] = (uint8) remainder;
-		}
-		else {
-			if (remainder) {
-				decimal->overflow = 1;
-			}
-		}
-		n = quotient;
-	}
-
-	while (n > 0) {
-		remainder = n - ((quotient = (n * 429496730) >> 32) * 10);
-		w--;
-		if (w < (int32) sizeof(decimal->digits)) {
-			decimal->digits[w] = (uint8) remainder;
-		}
-		else {
-			if (remainder) {
-				decimal->overflow = 1;
-			}
-		}
-		n = quotient;
-	}
-
-	decimal->n += delta;
-	if ((uint32) decimal->n >= sizeof(decimal->digits)) {
-		decimal->n = sizeof(decimal->digits);
-	}
-	decimal->decimalpoint += delta;
-	decimaltrim(decimal);
-}
-
-static void
-decimalshift(struct TDecimal* decimal, intxx amount)
-{
-	if (amount > 0) {
-		while (amount > +DECIMALMAXLSHIFT) {
-			decimallshift(decimal, DECIMALMAXLSHIFT);
-			amount -= DECIMALMAXLSHIFT;
-		}
-		if (amount) {
-			decimallshift(decimal, (uintxx) +amount);
-		}
-		return;
-	}
-
-	if (amount < 0) {
-		while (amount < -DECIMALMAXRSHIFT) {
-			decimalrshift(decimal, DECIMALMAXRSHIFT);
-			amount += DECIMALMAXRSHIFT;
-		}
-		if (amount) {
-			decimalrshift(decimal, (uintxx) -amount);
-		}
-		return;
-	}
-}
-
-static int32
-shouldroundup(struct TDecimal* decimal, int32 n)
-{
-	uint32 c;
-
-	if (n < 0 || n >= (int32) decimal->n) {
-		return 0;
-	}
-	c = (uint32) n;
-	if (decimal->digits[c] == 5 && c + 1 == (uint32) decimal->n) {
-		if (decimal->overflow) {
-			return 0;
-		}
-		return c > 0 && (decimal->digits[c - 1] & 1);
-	}
-	return decimal->digits[n] >= 5;
-}
-
-static uint64
-decimalroundinteger(struct TDecimal* decimal)
-{
-	int32 i;
-	uint64 n;
-
-	if (decimal->decimalpoint > 20) {
-		return 0xffffffffffffffffull;
-	}
-
-	n = 0;
-	i = 0;
-	while (i < decimal->decimalpoint && i < (int32) decimal->n) {
-		n = (n * 10) + decimal->digits[i++];
-	}
-	while (i < decimal->decimalpoint) {
-		n = (n * 10); i++;
-	}
-
-	if (shouldroundup(decimal, decimal->decimalpoint)) {
-		n++;
-	}
-	return n;
-}
-
-static void
-parsedecimal(const uint8* s, int32 total, int32 e10, struct TDecimal* r)
-{
-	int32 n;
-
-	r->overflow = 0;
-	r->n        = 0;
-
-	n = total;
-	for (n = total; n; s++) {
-		uint32 c;
-
-		c = s[0];
-		if (ctb_isdigit(c)) {
-			if (sizeof(r->digits) > (uint32) r->n) {
-				r->digits[r->n++] = (uint8) (c - 0x30);
-			}
-			else {
-				if (c ^ 0x30) {
-					r->overflow = 1;
-				}
-			}
-			n--;
-		}
-	}
-	r->decimalpoint = total + e10;
-	decimaltrim(r);
-}
-
-
-static struct TFltResult
-decimaltobinary(struct TDecimal* decimal, const struct TFLTType* f)
-{
-	int32 n;
-	int32 additionallshift;
-	int32  exp;
-	uint64 snd;
-	struct TFltResult r;
-
-	/* Decimal powers of 10 to powers of 2 */
-	const int32 pow10to2[] = {
-		0, 3, 6, 9, 13, 16, 19, 23, 26, 29, 33, 36, 39, 43, 46, 49, 53, 56, 59
-	};
-
-	/* Zero */
-	if (decimal->n == 0 || (decimal->n == 1 && decimal->digits[0] == 0)) {
-		return (struct TFltResult) {0, 0};
-	}
-
-	/* Underflow */
-	if (decimal->decimalpoint < -324) {
-		return (struct TFltResult) {0, 0};
-	}
-
-	/* Overflow */
-	if (decimal->decimalpoint > +311) {
-		return (struct TFltResult) {0, f->emask};
-	}
-
-	/* Scale by powers of 2 until it's in range [0.1, 10.0) */
-	exp = 0;
-	while (decimal->decimalpoint > 1) {
-		n = 60;
-
-		if (+decimal->decimalpoint < 19)
-			n = pow10to2[+decimal->decimalpoint];
-		decimalshift(decimal, -n);
-		if (decimal->decimalpoint < -2047) {
-			return (struct TFltResult) {0, 0};
-		}
-		exp += n;
-	}
-
-	while (decimal->decimalpoint < 0) {
-		n = 60;
-
-		if (-decimal->decimalpoint < 19)
-			n = pow10to2[-decimal->decimalpoint] + 1;
-		decimalshift(decimal, +n);
-		if (decimal->decimalpoint > +2047) {
-			return (struct TFltResult) {0, f->emask};
-		}
-		exp -= n;
-	}
-
-	/* The mantissa in the range [0.1, 10) we need to scale in to the
-	 * range [2, 1) */
-	n = 100 * decimal->digits[0];
-	if (decimal->n >= 3) {
-		n += 10 * decimal->digits[1] + decimal->digits[2];
-	}
-	else {
-		if (decimal->n > 1) {
-			n += 10 * decimal->digits[1];
-			if (decimal->n > 2) {
-				n += decimal->digits[2];
-			}
-		}
-	}
-
-	additionallshift = 0;
-	if (decimal->decimalpoint == 0) {
-		/* The mantissa is in the range [.1 .. 1) we need to scale it up */
-		if (n < 125) {
-			additionallshift = 4;
-		}
-		else {
-			if (n < 250) {
-				additionallshift = 3;
-			}
-			else {
-				if (n < 500) {
-					additionallshift = 2;
-				}
-				else {
-					additionallshift = 1;
-				}
-			}
-		}
-	}
-	else {
-		/* The mantissa is in the range [1 .. 10) we need to scale it down */
-		if (n < 200) {
-			additionallshift = 0;
-		}
-		else {
-			if (n < 400) {
-				additionallshift = -1;
-			}
-			else {
-				if (n < 800) {
-					additionallshift = -2;
-				}
-				else {
-					additionallshift = -3;
-				}
-			}
-		}
-	}
-
-	exp -= additionallshift;
-	additionallshift += f->sbits;
-
-	/* Minimum representable exponent is bias + 1
-	 * If the exponent is smaller, move it up and adjust the mantissa
-	 * accordingly */
-	if (exp < f->ebias + 1) {
-		n = f->ebias + 1 - exp;
-		decimalshift(decimal, -n);
-		exp += n;
-	}
-
-	/* Check for overflow */
-	if (exp - f->ebias >= f->emask) {
-		return (struct TFltResult) {0, f->emask};
-	}
-
-	/* Extract 53 bits for the mantissa (in base-2) */
-	decimalshift(decimal, additionallshift);
-	snd = decimalroundinteger(decimal);
-
-	/* Rounding might have added a bit */
-	if ((snd >> (f->sbits + 1)) != 0) {
-		snd = snd >> 1;
-		exp++;
-		if (exp - f->ebias >= f->emask) {
-			return (struct TFltResult) {0, f->emask};
-		}
-	}
-
-	/* Subnormal number */
-	if ((snd >> f->sbits) == 0) {
-		exp = f->ebias;
-	}
-
-	r.significand = (int64) ((snd)            & ((1ull << f->sbits) - 1));
-	r.exponent    = (int64) ((exp - f->ebias) & (f->emask));
-	return r;
-}
-
 /* ****************************************************************************
  * Eisel-Lemire algorithm, "Number Parsing at a Gigabyte per Second" by
  * Daniel Lemire
@@ -609,51 +77,6 @@ decimaltobinary(struct TDecimal* decimal, const struct TFLTType* f)
  * https://github.com/fastfloat/fast_float
  *************************************************************************** */
 
-/*  */
-struct TVal128 {
-	uint64 lo;
-	uint64 hi;
-};
-
-
-static struct TVal128
-mul64to128(uint64 lhs, uint64 rhs)
-{
-	struct TVal128 r;
-
-#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
-	__uint128_t product;
-
-	product = ((__uint128_t) lhs) * ((__uint128_t) rhs);
-	r.lo = (uint64) (product >> 00);
-	r.hi = (uint64) (product >> 64);
-#else
-	/*
-	 * Taken from xxHash3
-	 * See also: https://stackoverflow.com/a/58381061 */
-	uint64 loxlo;
-	uint64 loxhi;
-	uint64 hixlo;
-	uint64 hixhi;
-	uint64 upper;
-	uint64 cross;
-
-	/* first calculate all of the cross products. */
-	loxlo = (lhs & 0xffffffff) * (rhs & 0xffffffff);
-	hixlo = (lhs >> 32)        * (rhs & 0xffffffff);
-	loxhi = (lhs & 0xffffffff) * (rhs >> 32);
-	hixhi = (lhs >> 32)        * (rhs >> 32);
-
-	/* now add the products together. These will never overflow. */
-	cross = (loxlo >> 32) + (hixlo & 0xffffffff) + loxhi;
-	upper = (hixlo >> 32) + (cross >> 32)        + hixhi;
-
-	r.hi = upper;
-	r.lo = (cross << 32) | (loxlo & 0xffffffff);
-#endif
-	return r;
-}
-
 static int32
 countleadingzeros(uint64 n)
 {
@@ -743,22 +166,36 @@ countleadingzeros(uint64 n)
 #define MINPOWEROF5 -342
 #define MAXPOWEROF5 +308
 
+#if defined(CTB_CFG_COMPACTTABLES)
+
+static TUInt128 getpowerof5(int32 index);
+
+#else
+
 static const uint64 (*powersoffive128)[2];
 
+#endif
+
 
-CTB_INLINE struct TVal128
+CTB_INLINE TUInt128
 computeapproximation(uint64 w, int64 q, uint64 precisionmask)
 {
-	struct TVal128 fstproduct;
-	struct TVal128 sndproduct;
+	TUInt128 fstproduct;
+	TUInt128 sndproduct;
+	TUInt128 power;
 	int32 index;
 
 	index = (int32) (q - MINPOWEROF5);
+#if defined(CTB_CFG_COMPACTTABLES)
+	power = getpowerof5(index);
+#else
+	power = ctb_u128(powersoffive128[index][0], powersoffive128[index][1]);
+#endif
 
-	fstproduct = mul64to128(w, powersoffive128[index][0]);
+	fstproduct = ctb_mul64to128(w, power.hi);
 	if ((fstproduct.hi & precisionmask) == precisionmask) {
 		/* Wider approximation */
-		sndproduct = mul64to128(w, powersoffive128[index][1]);
+		sndproduct = ctb_mul64to128(w, power.lo);
 
 		fstproduct.lo += sndproduct.hi;
 		if (sndproduct.hi > fstproduct.lo) {
@@ -778,7 +215,7 @@ eisellemire(uint64 w, int32 q, const struct TFLTType* f)
 	uint64 m;
 	int64 p;
 	int64 l;  /* The number of leading zeros of w */
-	struct TVal128 z;
+	TUInt128 z;
 
 	if (q < MINPOWEROF5 || w == 0) {
 		return (struct TFltResult) {0, 0};
@@ -813,6 +250,14 @@ eisellemire(uint64 w, int32 q, const struct TFLTType* f)
 			 * have a zero for sure */
 			return (struct TFltResult) {0, 0};
 		}
+		if (q >= f->minexponentroundtoeven) {
+			/* possible tie (only the 16 bit types have subnormals here) */
+			if ((m & ((2ull << (-p + 1)) - 1)) == (1ull << (-p + 1))) {
+				if ((m << (u + 64 - (uint64) f->sbits - 3)) == z.hi) {
+					return (struct TFltResult) {-1ll, 0};
+				}
+			}
+		}
 		m >>= -p + 1;
 		m = m + (m & 1);  /* Round up */
 		m = m >> 1;
@@ -829,14 +274,22 @@ eisellemire(uint64 w, int32 q, const struct TFLTType* f)
 	}
 
 	/* Check if we are between two floats */
-	if (z.lo <= 1) {
-		if (q >= f->minexponentroundtoeven && q <= f->maxexponentroundtoeven) {
-			if ((m & 3) == 1) {
-				if ((m << (u + 64 - (uint64) f->sbits - 3)) == z.hi) {
+	if (q >= f->minexponentroundtoeven && q <= f->maxexponentroundtoeven) {
+		if ((m & 3) == 1) {
+			if ((m << (u + 64 - (uint64) f->sbits - 3)) == z.hi) {
+				if (z.lo <= 1) {
 					/* If we fall right in between and and we have an
 					 * even basis, we need to round down */
 					m &= ~1ull;  /* Flip the last bit so we don't round up */
 				}
+				else {
+					/* the negative powers are not exact, the error can
+					 * hide a tie (the 16 bit types have ties down to
+					 * 10^-26) */
+					if (q < 0) {
+						return (struct TFltResult) {-1ll, 0};
+					}
+				}
 			}
 		}
 	}
@@ -858,383 +311,1649 @@ L_DONE:
 }
 
 /* ****************************************************************************
- * Float parsing
+ * Digit comparison, used when Eisel-Lemire can not decide
+ *
+ * Based on the big integer slow path of fast_float:
+ * https://github.com/fastfloat/fast_float
+ *
+ * The digits are loaded in a big integer. For positive exponents the number
+ * is scaled by 5^e and rounded (the result is exact), for negative ones the
+ * digits are compared against the halfway point between the float below an
+ * approximation and the next one, both scaled to the same power of ten.
  *************************************************************************** */
 
-static int32
-parsenan(const uint8* s, const struct TFLTType* f, uint64* r)
-{
-	if ((s[0] | 0x20) == 'i' && (s[1] | 0x20) == 'n' && (s[2] | 0x20) == 'f') {
-		r[0] = FLTINF(f->sbits, f->ebits);
+/* 4096 bits, enough for 10^770 and for 5^1100 times a 54 bit halfway */
+#define BIGINTLIMBS 64
 
-		if ((s[3] | 0x20) == 'i' &&
-			(s[4] | 0x20) == 'n' &&
-			(s[5] | 0x20) == 'i' &&
-			(s[6] | 0x20) == 't' &&
-			(s[7] | 0x20) == 'y') {
-			return 8;
-		}
-		return 3;
-	}
-	if ((s[0] | 0x20) == 'n' && (s[1] | 0x20) == 'a' && (s[2] | 0x20) == 'n') {
-		r[0] = FLTNAN(f->sbits, f->ebits);
-		return 3;
-	}
-	return 0;
-}
+/* Little-endian big integer */
+struct TBigInt {
+	int32 n;
+	uint64 limbs[BIGINTLIMBS];
+};
 
-static int32
-parseexponent(const uint8* s, int32* exponent)
+
+static const uint64 u64powersof5[] = {
+	0x0000000000000001ull, 0x0000000000000005ull, 0x0000000000000019ull,
+	0x000000000000007dull, 0x0000000000000271ull, 0x0000000000000c35ull,
+	0x0000000000003d09ull, 0x000000000001312dull, 0x000000000005f5e1ull,
+	0x00000000001dcd65ull, 0x00000000009502f9ull, 0x0000000002e90eddull,
+	0x000000000e8d4a51ull, 0x0000000048c27395ull, 0x000000016bcc41e9ull,
+	0x000000071afd498dull, 0x0000002386f26fc1ull, 0x000000b1a2bc2ec5ull,
+	0x000003782dace9d9ull, 0x00001158e460913dull, 0x000056bc75e2d631ull,
+	0x0001b1ae4d6e2ef5ull, 0x000878678326eac9ull, 0x002a5a058fc295edull,
+	0x00d3c21bcecceda1ull, 0x0422ca8b0a00a425ull, 0x14adf4b7320334b9ull,
+	0x6765c793fa10079dull
+};
+
+static const uint64 u64powersof10[] = {
+	1ull,
+	10ull,
+	100ull,
+	1000ull,
+	10000ull,
+	100000ull,
+	1000000ull,
+	10000000ull,
+	100000000ull,
+	1000000000ull,
+	10000000000ull,
+	100000000000ull,
+	1000000000000ull,
+	10000000000000ull,
+	100000000000000ull,
+	1000000000000000ull,
+	10000000000000000ull,
+	100000000000000000ull,
+	1000000000000000000ull,
+	10000000000000000000ull
+};
+
+
+static void
+bigintmul1(struct TBigInt* b, uint64 y)
+{
+	int32 j;
+	uint64 carry;
+	TUInt128 r;
+
+	carry = 0;
+	for (j = 0; j < b->n; j++) {
+		r = ctb_mul64to128(b->limbs[j], y);
+		r.lo += carry;
+		carry = r.hi + (r.lo < carry);
+		b->limbs[j] = r.lo;
+	}
+	if (carry) {
+		CTB_ASSERT(b->n < BIGINTLIMBS);
+		b->limbs[b->n++] = carry;
+	}
+}
+
+static void
+bigintadd1(struct TBigInt* b, uint64 y)
+{
+	int32 j;
+
+	for (j = 0; y; j++) {
+		if (j == b->n) {
+			CTB_ASSERT(b->n < BIGINTLIMBS);
+			b->limbs[b->n++] = y;
+			break;
+		}
+		b->limbs[j] += y;
+		y = b->limbs[j] < y;
+	}
+}
+
+static void
+bigintpow5(struct TBigInt* b, int32 e)
+{
+	for (; e >= 27; e -= 27) {
+		bigintmul1(b, u64powersof5[27]);
+	}
+	if (e) {
+		bigintmul1(b, u64powersof5[e]);
+	}
+}
+
+static void
+bigintshl(struct TBigInt* b, int32 n)
+{
+	int32 j;
+	int32 s;
+	uint32 r;
+	uint64 carry;
+
+	if (b->n == 0) {
+		return;
+	}
+
+	r = (uint32) n & 63;
+	if (r) {
+		carry = 0;
+		for (j = 0; j < b->n; j++) {
+			uint64 v;
+
+			v = b->limbs[j];
+			b->limbs[j] = (v << r) | carry;
+			carry = v >> (64 - r);
+		}
+		if (carry) {
+			CTB_ASSERT(b->n < BIGINTLIMBS);
+			b->limbs[b->n++] = carry;
+		}
+	}
+
+	s = n >> 6;
+	if (s) {
+		CTB_ASSERT(b->n + s <= BIGINTLIMBS);
+		for (j = b->n - 1; j >= 0; j--) {
+			b->limbs[j + s] = b->limbs[j];
+		}
+		for (j = 0; j < s; j++) {
+			b->limbs[j] = 0;
+		}
+		b->n += s;
+	}
+}
+
+static int32
+bigintcmp(const struct TBigInt* a, const struct TBigInt* b)
+{
+	int32 j;
+
+	if (a->n != b->n) {
+		return a->n > b->n ? 1 : -1;
+	}
+	for (j = a->n - 1; j >= 0; j--) {
+		if (a->limbs[j] != b->limbs[j]) {
+			return a->limbs[j] > b->limbs[j] ? 1 : -1;
+		}
+	}
+	return 0;
+}
+
+static int32
+bigintbitlength(const struct TBigInt* b)
+{
+	if (b->n == 0) {
+		return 0;
+	}
+	return (b->n << 6) - countleadingzeros(b->limbs[b->n - 1]);
+}
+
+/*
+ * Returns the 64 most significant bits (b must not be zero), truncated is
+ * set if any of the other bits is set. */
+static uint64
+biginthi64(const struct TBigInt* b, uintxx* truncated)
+{
+	int32 j;
+	int32 n;
+	int32 lz;
+	uint64 r;
+
+	n = b->n;
+	lz = countleadingzeros(b->limbs[n - 1]);
+	r = b->limbs[n - 1] << lz;
+	truncated[0] = 0;
+	if (n >= 2) {
+		if (lz) {
+			r |= b->limbs[n - 2] >> (64 - lz);
+		}
+		truncated[0] = (b->limbs[n - 2] << lz) != 0;
+		for (j = n - 3; j >= 0 && truncated[0] == 0; j--) {
+			truncated[0] = b->limbs[j] != 0;
+		}
+	}
+	return r;
+}
+
+/*
+ * Loads up to maxdigits digits (skipping the decimal point), if there are
+ * more a sticky 1 digit stands for the rest when they are not all zero.
+ * Returns the number of digits loaded. */
+static int32
+bigintfromdigits(struct TBigInt* b, const uint8* s, int32 total, int32 maxdigits)
+{
+	int32 j;
+	int32 k;
+	int32 n;
+	uint32 c;
+	uint64 v;
+
+	b->n = 0;
+	n = total < maxdigits ? total : maxdigits;
+
+	v = 0;
+	k = 0;
+	for (j = 0; j < n; s++) {
+		c = (uint32) (s[0] - 0x30);
+		if (c > 9) {
+			continue;
+		}
+		v = v * 10 + c;
+		j++;
+		if (++k == 19) {
+			bigintmul1(b, u64powersof10[19]);
+			bigintadd1(b, v);
+			v = 0;
+			k = 0;
+		}
+	}
+
+	for (; j < total; s++) {
+		c = (uint32) (s[0] - 0x30);
+		if (c > 9) {
+			continue;
+		}
+		if (c) {
+			v = v * 10 + 1;
+			k++;
+			n++;
+			break;
+		}
+		j++;
+	}
+
+	if (k) {
+		bigintmul1(b, u64powersof10[k]);
+		bigintadd1(b, v);
+	}
+	return n;
+}
+
+/*
+ * Rounds (to nearest, ties to even) a normalized 64 bit significand with the
+ * exponent of its most significant bit, truncated is set when there are
+ * more bits below. */
+static struct TFltResult
+roundnearest(uint64 hi, int32 e2, uintxx truncated, const struct TFLTType* f)
+{
+	int64 p;
+	uint64 m;
+	uint64 r;
+	uint64 h;
+	uint64 bits;
+	int32 shift;
+
+	p = e2 - f->ebias;
+	if (p >= f->emask) {
+		return (struct TFltResult) {0, f->emask};
+	}
+
+	shift = 63 - f->sbits;
+	if (p < 1) {
+		/* subnormal */
+		shift += (int32) (1 - p);
+		if (shift > 64) {
+			return (struct TFltResult) {0, 0};
+		}
+		p = 1;
+	}
+
+	if (shift == 64) {
+		m = 0;
+		r = hi;
+	}
+	else {
+		m = hi >> shift;
+		r = hi & ((1ull << shift) - 1);
+	}
+	h = 1ull << (shift - 1);
+	if (r > h || (r == h && (truncated || (m & 1)))) {
+		m++;
+	}
+
+	/* the hidden bit (or the carry of the rounding) goes to the exponent */
+	bits = ((uint64) (p - 1) << f->sbits) + m;
+	if ((bits >> f->sbits) >= (uint64) f->emask) {
+		return (struct TFltResult) {0, f->emask};
+	}
+	return (struct TFltResult) {
+		(int64) (bits & ((1ull << f->sbits) - 1)), (int64) (bits >> f->sbits)
+	};
+}
+
+static struct TFltResult
+positivedigitcomp(struct TBigInt* a, int32 e10, const struct TFLTType* f)
+{
+	uint64 hi;
+	uintxx truncated[1];
+
+	bigintpow5(a, e10);
+	hi = biginthi64(a, truncated);
+	return roundnearest(hi, bigintbitlength(a) - 1 + e10, truncated[0], f);
+}
+
+static struct TFltResult
+negativedigitcomp(struct TBigInt* a, int32 k, const struct TFLTType* f)
+{
+	struct TBigInt b;
+	uint64 q;
+	uint64 ha;
+	uint64 hb;
+	uint64 mb;
+	uint64 r[1];
+	uint64 bits;
+	int64 p;
+	int32 e2;
+	int32 eb;
+	int32 s;
+	int32 lz;
+	uintxx truncated[1];
+
+	b.n = 1;
+	b.limbs[0] = 1;
+	bigintpow5(&b, k);
+
+	/* approximation of a / 10^k from the 64 most significant bits of a and
+	 * of 5^k, the relative error is below 2^-60 */
+	ha = biginthi64(a, truncated);
+	hb = biginthi64(&b, truncated);
+	q = ctb_u128divmod64(ctb_u128(ha >> 1, ha << 63), hb, r).lo;
+	lz = countleadingzeros(q);
+	q = q << lz;
+	e2 = bigintbitlength(a) - bigintbitlength(&b) - k - lz;
+
+	/* the float below (or near) the approximation, as mb * 2^eb */
+	p = e2 - f->ebias;
+	if (p >= f->emask) {
+		return (struct TFltResult) {0, f->emask};
+	}
+	if (p >= 1) {
+		mb = q >> (63 - f->sbits);
+		eb = e2 - f->sbits;
+	}
+	else {
+		s = 63 - f->sbits + 1 - (int32) p;
+		mb = s < 64 ? q >> s : 0;
+		eb = 1 + f->ebias - f->sbits;
+		p = 0;
+	}
+	bits = ((uint64) p << f->sbits) | (mb & ((1ull << f->sbits) - 1));
+
+	/* compare a * 10^-k with the halfway point (2 * mb + 1) * 2^(eb - 1) */
+	bigintmul1(&b, 2 * mb + 1);
+	s = eb - 1 + k;
+	if (s > 0) {
+		bigintshl(&b, +s);
+	}
+	else {
+		if (s < 0) {
+			bigintshl(a, -s);
+		}
+	}
+
+	s = bigintcmp(a, &b);
+	if (s > 0 || (s == 0 && (mb & 1))) {
+		bits++;
+	}
+	return (struct TFltResult) {
+		(int64) (bits & ((1ull << f->sbits) - 1)), (int64) (bits >> f->sbits)
+	};
+}
+
+static struct TFltResult
+digitcomparison(const uint8* start, int32 total, int32 e10, const struct TFLTType* f)
+{
+	struct TBigInt a;
+	int32 n;
+	int32 e;
+
+	n = bigintfromdigits(&a, start, total, f->maxdigits);
+	if (a.n == 0) {
+		return (struct TFltResult) {0, 0};
+	}
+
+	/* exponent of the last digit loaded */
+	e = e10 + (total - n);
+	if (e + n - 1 > 310) {
+		return (struct TFltResult) {0, f->emask};
+	}
+	if (e + n - 1 < -326) {
+		return (struct TFltResult) {0, 0};
+	}
+
+	if (e >= 0) {
+		return positivedigitcomp(&a, e, f);
+	}
+	return negativedigitcomp(&a, -e, f);
+}
+
+#undef BIGINTLIMBS
+
+
+/* ****************************************************************************
+ * Clinger fast path
+ * W. D. Clinger, "How to read floating point numbers accurately"
+ *
+ * If the significand and the power of ten are exact in the float type the
+ * correctly rounded result is one multiplication (or division). This needs
+ * the operations to be evaluated in the precision of the type.
+ *************************************************************************** */
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+	#define CLINGERFASTPATH
+#endif
+
+#if defined(CLINGERFASTPATH)
+
+static const flt64 flt64powersof10[] = {
+	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+	1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+	1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const flt32 flt32powersof10[] = {
+	1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+
+/* Largest exact power of ten and largest exact integer */
+#define FLT64MAXPOW10 22
+#define FLT32MAXPOW10 10
+#define FLT64MAXINT (1ull << 53)
+#define FLT32MAXINT (1ull << 24)
+
+/*
+ * Returns 1 and stores the bits of w * 10^e10 in r when the result can be
+ * computed exactly. The second case ("1e30", "123e25") moves the excess of
+ * the exponent into the significand while it stays exact. */
+static uintxx
+clinger(uint64 w, int32 e10, uintxx mode, uint64* r)
+{
+	int32 maxpow10;
+	uint64 maxint;
+
+	if (mode == FLT64MODE) {
+		maxpow10 = FLT64MAXPOW10;
+		maxint   = FLT64MAXINT;
+	}
+	else {
+		/* no native arithmetic for the 16 bit types */
+		if (mode != FLT32MODE) {
+			return 0;
+		}
+		maxpow10 = FLT32MAXPOW10;
+		maxint   = FLT32MAXINT;
+	}
+
+	if (w > maxint || e10 < -maxpow10) {
+		return 0;
+	}
+	if (e10 > maxpow10) {
+		int32 k;
+
+		k = e10 - maxpow10;
+		if (k > 15 || w > maxint / u64powersof10[k]) {
+			return 0;
+		}
+		w   = w * u64powersof10[k];
+		e10 = maxpow10;
+	}
+
+	if (mode == FLT64MODE) {
+		union {
+			flt64 f; uint64 u;
+		}
+		m;
+
+		m.f = (flt64) w;
+		if (e10 < 0) {
+			m.f = m.f / flt64powersof10[-e10];
+		}
+		else {
+			m.f = m.f * flt64powersof10[+e10];
+		}
+		r[0] = m.u;
+	}
+	else {
+		union {
+			flt32 f; uint32 u;
+		}
+		m;
+
+		m.f = (flt32) w;
+		if (e10 < 0) {
+			m.f = m.f / flt32powersof10[-e10];
+		}
+		else {
+			m.f = m.f * flt32powersof10[+e10];
+		}
+		r[0] = m.u;
+	}
+	return 1;
+}
+
+#undef FLT64MAXPOW10
+#undef FLT32MAXPOW10
+#undef FLT64MAXINT
+#undef FLT32MAXINT
+
+#endif
+
+
+/* ****************************************************************************
+ * Float parsing
+ *************************************************************************** */
+
+#if defined(__clang__)
+	#pragma clang diagnostic push
+	#pragma clang diagnostic ignored "-Wcast-align"
+#endif
+
+/*
+ * SWAR digit conversion. */
+#define CTB_INTERNAL_INCLUDE_GUARD
+	#include <ctoolbox/private/swardigits.h>
+#undef CTB_INTERNAL_INCLUDE_GUARD
+
+/*
+ * Reads a run of digits of at most size characters, the first ones (up to
+ * 19 significant digits in total) are accumulated in significand, the rest
+ * are only counted. When the input is not bounded the 8 byte loads stop at
+ * the page boundary (see CANREAD8). Returns the number of digits read. */
+CTB_FORCEINLINE int32
+readdigits(const uint8* s, uintxx size, uintxx bounded, uint64* significand, int32 n)
+{
+	uint32 c;
+	uint64 r;
+	uintxx i;
+	uintxx m;
+
+	r = significand[0];
+	i = 0;
+#if !defined(SWARDIGITS)
+	(void) bounded;
+#endif
+
+#if defined(SWARDIGITS)
+	for (; size - i >= 8 && n + (int32) i <= 11; i += 8) {
+		uint64 v;
+		uint64 d;
+		uintxx k;
+
+		if (bounded == 0 && CANREAD8(s + i) == 0) {
+			break;
+		}
+
+		v = ((const uint64*) (s + i))[0];
+		d = nondigits8(v);
+		v = v - 0x3030303030303030ull;
+		if (d) {
+			k = firstbyte(d);
+			if (k) {
+				r = r * powersof10[k] + convert8(v << ((8 - k) << 3));
+			}
+			i += k;
+			goto L1;
+		}
+		r = r * 100000000 + convert8(v);
+	}
+#endif
+
+	m = 0;
+	if (n + (int32) i < 19) {
+		m = (uintxx) (19 - n) - i;
+		if (m > size - i) {
+			m = size - i;
+		}
+	}
+	for (m += i; i < m; i++) {
+		c = (uint32) (s[i] - 0x30);
+		if (c > 9) {
+			goto L1;
+		}
+		r = r * 10 + c;
+	}
+
+#if defined(SWARDIGITS)
+	for (; size - i >= 8; i += 8) {
+		uint64 d;
+
+		if (bounded == 0 && CANREAD8(s + i) == 0) {
+			break;
+		}
+
+		d = nondigits8(((const uint64*) (s + i))[0]);
+		if (d) {
+			i += firstbyte(d);
+			goto L1;
+		}
+	}
+#endif
+	for (; i < size; i++) {
+		if ((uint32) (s[i] - 0x30) > 9) {
+			break;
+		}
+	}
+
+L1:
+	significand[0] = r;
+	return (int32) i;
+}
+
+#if defined(__clang__)
+	#pragma clang diagnostic pop
+#endif
+
+static int32
+parsenan(const uint8* s, uintxx size, const struct TFLTType* f, uint64* r)
+{
+	if (size < 3) {
+		return 0;
+	}
+
+	if ((s[0] | 0x20) == 'i' && (s[1] | 0x20) == 'n' && (s[2] | 0x20) == 'f') {
+		r[0] = FLTINF(f->sbits, f->ebits);
+
+		if (size >= 8 &&
+			(s[3] | 0x20) == 'i' &&
+			(s[4] | 0x20) == 'n' &&
+			(s[5] | 0x20) == 'i' &&
+			(s[6] | 0x20) == 't' &&
+			(s[7] | 0x20) == 'y') {
+			return 8;
+		}
+		return 3;
+	}
+	if ((s[0] | 0x20) == 'n' && (s[1] | 0x20) == 'a' && (s[2] | 0x20) == 'n') {
+		r[0] = FLTNAN(f->sbits, f->ebits);
+		return 3;
+	}
+	return 0;
+}
+
+/*
+ * Returns the number of characters consumed (sign included), zero if there
+ * are no digits. */
+static int32
+parseexponent(const uint8* s, uintxx size, int32* exponent)
+{
+	int32 i;
+	int32 n;
+	int32 e;
+	int32 isnegative;
+
+	i = 0;
+	isnegative = 0;
+	if (size) {
+		if (s[0] == 0x2d) {
+			isnegative = 1;
+			i++;
+		}
+		else {
+			if (s[0] == 0x2b) {
+				i++;
+			}
+		}
+	}
+
+	n = 0;
+	e = 0;
+	for (s += i, size -= (uintxx) i; size; s++, size--) {
+		if (ctb_isdigit(s[0]) == 0) {
+			break;
+		}
+		if (e < 10000) {
+			e = e * 10 + (s[0] - 0x30);
+		}
+		n++;
+	}
+	if (n == 0) {
+		exponent[0] = 0;
+		return 0;
+	}
+
+	if (isnegative)
+		e = -e;
+	exponent[0] = e;
+	return i + n;
+}
+
+
+static uint64 tobinary(const uint8*, int32, uint64, int32, uintxx);
+
+/* size used by the NUL terminated variants, the scan stops at the NUL */
+#define NOBOUND ((uintxx) -1)
+
+static eintxx
+parsefloat(const uint8* src, uintxx size, const uint8** end, uintxx mode, uint64* result)
+{
+	int32 start;
+	int32 total;
+	int32 i;
+	int32 isnegative;
+	int32 decimalpoint;
+	int32 e10;
+	int32 zcountf;
+	int32 zcounti;
+	uint64 significand;
+	eintxx r;
+	uintxx bounded;
+	const uint8* s;
+	const struct TFLTType* f;
+
+	s = src;
+	bounded = size != NOBOUND;
+
+	/* Consume the white space */
+	while (size && ctb_isspace(s[0])) {
+		s++;
+		size--;
+	}
+
+	significand = 0;
+	e10 = 0;  /* Exponent */
+	decimalpoint = -1;
+
+	/* Number of zeros after the decimal point if the integral part is zero */
+	zcountf = 0;
+	zcounti = 0;  /* Number of zeros before the decimal point */
+
+	/* Check the sign */
+	isnegative = 0;
+	if (size) {
+		if (s[0] == 0x2d) {
+			isnegative = 1;
+			s++;
+			size--;
+		}
+		else {
+			if (s[0] == 0x2b) {
+				s++;
+				size--;
+			}
+		}
+	}
+
+	f = flttype + mode;
+	if (size == 0 || ctb_isdigit(s[0]) == 0) {
+		if (size && s[0] == 0x2e) {
+			decimalpoint = 0;
+			s++;
+			size--;
+
+			goto L1;
+		}
+
+		i = parsenan(s, size, f, result);
+		if (i) {
+			if (isnegative)
+				result[0] |= 1ull << (f->sbits + f->ebits);
+			if (end) {
+				end[0] = s + i;
+			}
+			return 0;
+		}
+
+		if (end) {
+			end[0] = src;
+		}
+
+		result[0] = FLTNAN(f->sbits, f->ebits);
+		return STR2FLT_ENAN;
+	}
+
+	/* 0s prefix */
+	while (size && s[0] == 0x30) {
+		zcounti++;
+		s++;
+		size--;
+	}
+
+	if (size && s[0] == 0x2e) {
+		decimalpoint = 0;
+		s++;
+		size--;
+	}
+
+L1:
+	/* */
+	while (size && s[0] == 0x30) {
+		zcountf++;
+		s++;
+		size--;
+	}
+
+	start = (int32) (s - (const uint8*) src);
+
+	/* Parse the digits, the first 19 are accumulated in the significand */
+	total = readdigits(s, size, bounded, &significand, 0);
+	s    += total;
+	size -= (uintxx) total;
+
+	if (decimalpoint == -1 && size && s[0] == 0x2e) {
+		decimalpoint = total;
+		s++;
+		size--;
+
+		i = readdigits(s, size, bounded, &significand, total);
+		s    += i;
+		size -= (uintxx) i;
+		total += i;
+	}
+
+	if (total == 0) {
+		if (zcountf || zcounti) {
+			result[0] = 0;
+			if (isnegative)
+				result[0] |= 1ull << (f->sbits + f->ebits);
+
+			/* Parse the exponent (if any) */
+			if (size > 1 && (s[0] == 0x45 || s[0] == 0x65)) {
+				int32 e[1];
+
+				i = parseexponent(s + 1, size - 1, e);
+				if (i)
+					s += i + 1;
+			}
+
+			if (end)
+				end[0] = s;
+			return 0;
+		}
+
+		if (end)
+			end[0] = src;
+
+		result[0] = FLTNAN(f->sbits, f->ebits);
+		return STR2FLT_ENAN;
+	}
+
+	if (decimalpoint == -1) {
+		decimalpoint = total;
+	}
+
+	/* We have an exponent */
+	if (size > 1 && (s[0] == 0x45 || s[0] == 0x65)) {
+		int32 e[1];
+
+		i = parseexponent(s + 1, size - 1, e);
+		if (i)
+			s += i + 1;
+		e10 = e[0];
+	}
+
+	/* Normalize the exponent */
+	e10 = e10 - (total - decimalpoint) - zcountf;
+
+	result[0] = tobinary(src + start, total, significand, e10, mode);
+	r = 0;
+	if (result[0] == 0 || result[0] == FLTINF(f->sbits, f->ebits)) {
+		r = STR2FLT_ERANGE;
+	}
+	if (isnegative)
+		result[0] |= 1ull << (f->sbits + f->ebits);
+	if (end)
+		end[0] = s;
+	return r;
+}
+
+static uint64
+tobinary(const uint8* start, int32 total, uint64 snd, int32 e10, uintxx mode)
+{
+	struct TFltResult r1;
+	struct TFltResult r2;
+	const struct TFLTType* f;
+
+	f = flttype + mode;
+#if defined(CLINGERFASTPATH)
+	if (total < 20) {
+		uint64 r;
+
+		if (clinger(snd, e10, mode, &r)) {
+			return r;
+		}
+	}
+#else
+	if (e10 == 0 && snd < (1ull << f->sbits)) {
+		switch (mode) {
+			case FLT32MODE: {
+				union {
+					flt32 f; uint32 u;
+				}
+				m;
+
+				m.f = (flt32) snd;
+				return (uint64) m.u;
+			}
+			break;
+
+			case FLT64MODE: {
+				union {
+					flt64 f; uint64 u;
+				}
+				m;
+
+				m.f = (flt64) snd;
+				return (uint64) m.u;
+			}
+			break;
+		}
+	}
+#endif
+
+	if (total < 20) {
+		r1 = eisellemire(snd, e10, f);
+	}
+	else {
+		int32 ajustedexponent;
+
+		ajustedexponent = (total + e10) - 19;
+		r1 = eisellemire(snd + 0, ajustedexponent, f);
+		r2 = eisellemire(snd + 1, ajustedexponent, f);
+
+		if (r1.significand != r2.significand || r1.exponent != r2.exponent) {
+			r1.significand = -1ll;
+		}
+		else {
+			if (r2.significand == -1ll) {
+				r1.significand = -1ll;
+			}
+		}
+	}
+
+	if (r1.significand == -1ll) {
+		r1 = digitcomparison(start, total, e10, f);
+	}
+	return (uint64) (r1.significand | (r1.exponent << f->sbits));
+}
+
+
+static struct TToFltResult
+toflt64(const uint8* src, uintxx size, const uint8** end)
+{
+	struct TToFltResult result;
+	uint64 u;
+	union {
+		flt64 f; uint64 u;
+	}
+	m;
+
+	result.error = parsefloat(src, size, end, FLT64MODE, &u);
+
+	m.u = u;
+	result.value.asf64 = m.f;
+	return result;
+}
+
+static struct TToFltResult
+toflt32(const uint8* src, uintxx size, const uint8** end)
+{
+	struct TToFltResult result;
+	uint64 u;
+	union {
+		flt32 f; uint32 u;
+	}
+	m;
+
+	result.error = parsefloat(src, size, end, FLT32MODE, &u);
+
+	m.u = (uint32) u;
+	result.value.asf32 = m.f;
+	return result;
+}
+
+
+struct TToFltResult
+str2flt64(const uint8* src, const uint8** end)
+{
+	CTB_ASSERT(src);
+	return toflt64(src, NOBOUND, end);
+}
+
+struct TToFltResult
+str2flt32(const uint8* src, const uint8** end)
+{
+	CTB_ASSERT(src);
+	return toflt32(src, NOBOUND, end);
+}
+
+struct TToFltResult
+str2flt64n(const uint8* src, intxx total, const uint8** end)
+{
+	CTB_ASSERT(src);
+	return toflt64(src, total > 0 ? (uintxx) total : 0, end);
+}
+
+struct TToFltResult
+str2flt32n(const uint8* src, intxx total, const uint8** end)
+{
+	CTB_ASSERT(src);
+	return toflt32(src, total > 0 ? (uintxx) total : 0, end);
+}
+
+static struct TToFltResult
+toflt16(const uint8* src, uintxx size, const uint8** end, uintxx mode)
+{
+	struct TToFltResult result;
+	uint64 u;
+
+	result.error = parsefloat(src, size, end, mode, &u);
+	result.value.asf16 = (uint16) u;
+	return result;
+}
+
+struct TToFltResult
+str2flt16(const uint8* src, const uint8** end)
+{
+	CTB_ASSERT(src);
+	return toflt16(src, NOBOUND, end, FLT16MODE);
+}
+
+struct TToFltResult
+str2bf16(const uint8* src, const uint8** end)
+{
+	CTB_ASSERT(src);
+	return toflt16(src, NOBOUND, end, BF16MODE);
+}
+
+struct TToFltResult
+str2flt16n(const uint8* src, intxx total, const uint8** end)
+{
+	CTB_ASSERT(src);
+	return toflt16(src, total > 0 ? (uintxx) total : 0, end, FLT16MODE);
+}
+
+struct TToFltResult
+str2bf16n(const uint8* src, intxx total, const uint8** end)
+{
+	CTB_ASSERT(src);
+	return toflt16(src, total > 0 ? (uintxx) total : 0, end, BF16MODE);
+}
+
+
+/* ****************************************************************************
+ * Hexadecimal floats
+ *************************************************************************** */
+
+CTB_INLINE uint32
+hexvalue(uint32 c)
+{
+	if (c - 0x30 <= 9) {
+		return c - 0x30;
+	}
+	c = c | 0x20;
+	if (c - 0x61 <= 5) {
+		return c - 0x61 + 10;
+	}
+	return 0xff;
+}
+
+static eintxx
+parsehexfloat(const uint8* src, uintxx size, const uint8** end, uintxx mode, uint64* result)
 {
+	uint32 c;
 	int32 i;
-	int32 e;
-	int32 isnegative;
+	int32 k;
+	int32 e2;
+	uint64 m;
+	uintxx any;
+	uintxx sticky;
+	uintxx isnegative;
+	eintxx r;
+	const uint8* s;
+	const uint8* e;
+	const struct TFLTType* f;
+
+	f = flttype + mode;
+	e = (s = src) + size;
 
 	isnegative = 0;
-	if (s[0] == 0x2d) {
-		isnegative = 1;
-		s++;
+	if (s < e) {
+		switch (s[0]) {
+			case 0x2d: isnegative = 1; s++; break;
+			case 0x2b: isnegative = 0; s++; break;
+		}
 	}
-	else {
-		if (s[0] == 0x2b) {
-			s++;
+	if (e - s >= 2 && s[0] == 0x30 && (s[1] | 0x20) == 0x78) {
+		s += 2;
+	}
+
+	m  = 0;
+	e2 = 0;
+	any = 0;
+	sticky = 0;
+
+	/* the first 16 significant digits are kept, the rest are sticky */
+	for (; s < e && (c = hexvalue(s[0])) != 0xff; s++) {
+		if ((m >> 60) == 0) {
+			m = (m << 4) | c;
+		}
+		else {
+			sticky |= c != 0;
+			e2 += 4;
+		}
+		any = 1;
+	}
+	if (s < e && s[0] == 0x2e) {
+		for (s++; s < e && (c = hexvalue(s[0])) != 0xff; s++) {
+			if ((m >> 60) == 0) {
+				m = (m << 4) | c;
+				e2 -= 4;
+			}
+			else {
+				sticky |= c != 0;
+			}
+			any = 1;
 		}
 	}
 
-	i = 0;
-	e = 0;
-	while (ctb_isdigit(s[0])) {
-		e = e * 10 + (s[0] - 0x30);
-		if (e > 10000) {
-			while (ctb_isdigit(s[0])) {
+	if (any == 0) {
+		i = parsenan(src + isnegative, size - isnegative, f, result);
+		if (i) {
+			if (isnegative)
+				result[0] |= 1ull << (f->sbits + f->ebits);
+			if (end)
+				end[0] = src + isnegative + i;
+			return 0;
+		}
+
+		if (end)
+			end[0] = src;
+		result[0] = FLTNAN(f->sbits, f->ebits);
+		return STR2FLT_ENAN;
+	}
+
+	/* binary exponent (the "p" is not consumed if there are no digits) */
+	if (e - s >= 2 && (s[0] | 0x20) == 0x70) {
+		const uint8* p;
+		uintxx isnegativeexp;
+
+		p = s + 1;
+		isnegativeexp = 0;
+		if (p[0] == 0x2d || p[0] == 0x2b) {
+			isnegativeexp = p[0] == 0x2d;
+			p++;
+		}
+		if (p < e && ctb_isdigit(p[0])) {
+			for (k = 0; p < e && ctb_isdigit(p[0]); p++) {
+				if (k < 100000) {
+					k = k * 10 + (int32) (p[0] - 0x30);
+				}
+			}
+			e2 += isnegativeexp ? -k : k;
+			s = p;
+		}
+	}
+
+	if (end)
+		end[0] = s;
+
+	r = 0;
+	result[0] = 0;
+	if (m) {
+		struct TFltResult b;
+
+		k = countleadingzeros(m);
+		b = roundnearest(m << k, e2 + 63 - k, sticky, f);
+		result[0] = (uint64) (b.significand | (b.exponent << f->sbits));
+		if (result[0] == 0 || result[0] == FLTINF(f->sbits, f->ebits)) {
+			r = STR2FLT_ERANGE;
+		}
+	}
+	if (isnegative)
+		result[0] |= 1ull << (f->sbits + f->ebits);
+	return r;
+}
+
+
+struct TToFltResult
+hexatoflt64(const uint8* src, intxx total, const uint8** end)
+{
+	struct TToFltResult result;
+	uint64 u;
+	union {
+		flt64 f; uint64 u;
+	}
+	m;
+	CTB_ASSERT(src);
+
+	result.error = parsehexfloat(src, total > 0 ? (uintxx) total : 0, end, FLT64MODE, &u);
+
+	m.u = u;
+	result.value.asf64 = m.f;
+	return result;
+}
+
+struct TToFltResult
+hexatoflt32(const uint8* src, intxx total, const uint8** end)
+{
+	struct TToFltResult result;
+	uint64 u;
+	union {
+		flt32 f; uint32 u;
+	}
+	m;
+	CTB_ASSERT(src);
+
+	result.error = parsehexfloat(src, total > 0 ? (uintxx) total : 0, end, FLT32MODE, &u);
+
+	m.u = (uint32) u;
+	result.value.asf32 = m.f;
+	return result;
+}
+
+
+/* ****************************************************************************
+ * Batch conversion
+ *************************************************************************** */
+
+#define ISDELIMITER(T, C) (((T)[(C) >> 6] >> ((C) & 63)) & 1)
+
+static TToFltBatchResult
+parsebatch(const uint8* src, uintxx total, const uint8* delimiters, uintxx flags, void* dst, uintxx maxcount, uintxx mode)
+{
+	const uint8* s;
+	const uint8* p;
+	const uint8* e[1];
+	eintxx error;
+	uint64 u;
+	uint64 table[4];
+	struct TToFltBatchResult result;
+
+	/* the delimiters as a bitmap */
+	table[0] = table[1] = table[2] = table[3] = 0;
+	for (; delimiters[0]; delimiters++) {
+		table[delimiters[0] >> 6] |= 1ull << (delimiters[0] & 63);
+	}
+
+	result.error = 0;
+	result.count = 0;
+	p = (s = src) + total;
+	if (total == 0) {
+		result.position = 0;
+		return result;
+	}
+
+	while (result.count < maxcount) {
+		if (flags & STR2FLT_SKIPSPACE) {
+			while (s < p && ctb_isspace(s[0]) && ISDELIMITER(table, s[0]) == 0)
 				s++;
-				i++;
+		}
+
+		if (s == p || ISDELIMITER(table, s[0])) {
+			if ((flags & STR2FLT_ALLOWEMPTY) == 0) {
+				error = STR2FLT_ENAN;
+				goto L2;
+			}
+			u = 0;
+		}
+		else {
+			if (CTB_EXPECT0(ctb_isspace(s[0]))) {
+				error = STR2FLT_ENAN;
+				goto L2;
+			}
+
+			error = parsefloat(s, (uintxx) (p - s), e, mode, &u);
+			if (CTB_EXPECT0(error != 0)) {
+				goto L2;
+			}
+			s = e[0];
+		}
+
+		if (flags & STR2FLT_SKIPSPACE) {
+			while (s < p && ctb_isspace(s[0]) && ISDELIMITER(table, s[0]) == 0)
+				s++;
+		}
+
+		if (s != p && CTB_EXPECT0(ISDELIMITER(table, s[0]) == 0)) {
+			error = STR2FLT_ENAN;
+			goto L2;
+		}
+
+		switch (mode) {
+			case FLT64MODE: {
+				union {
+					flt64 f; uint64 u;
+				}
+				m;
+
+				m.u = u;
+				((flt64*) dst)[result.count++] = m.f;
+			}
+			break;
+
+			case FLT32MODE: {
+				union {
+					flt32 f; uint32 u;
+				}
+				m;
+
+				m.u = (uint32) u;
+				((flt32*) dst)[result.count++] = m.f;
 			}
 			break;
+
+			default:
+				((uint16*) dst)[result.count++] = (uint16) u;
+		}
+
+		if (s == p) {
+			result.position = total;
+			return result;
 		}
 		s++;
-		i++;
-	}
-	if (i == 0) {
-		exponent[0] = 0;
-		return 0;
 	}
 
-	if (isnegative)
-		e = -e;
-	exponent[0] = e;
-	return i;
-}
+	result.position = (uintxx) (s - src);
+	return result;
+
+L2:
+	result.error = error;
+	result.position = (uintxx) (s - src);
+	return result;
+}
+
+#undef ISDELIMITER
+
+
+TToFltBatchResult
+str2flt64batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, flt64* dst, uintxx maxcount)
+{
+	CTB_ASSERT(src && delimiters && dst);
+
+	return parsebatch(src, total > 0 ? (uintxx) total : 0, delimiters, flags, dst, maxcount, FLT64MODE);
+}
+
+TToFltBatchResult
+str2flt32batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, flt32* dst, uintxx maxcount)
+{
+	CTB_ASSERT(src && delimiters && dst);
+
+	return parsebatch(src, total > 0 ? (uintxx) total : 0, delimiters, flags, dst, maxcount, FLT32MODE);
+}
+
+TToFltBatchResult
+str2flt16batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, uint16* dst, uintxx maxcount)
+{
+	CTB_ASSERT(src && delimiters && dst);
+
+	return parsebatch(src, total > 0 ? (uintxx) total : 0, delimiters, flags, dst, maxcount, FLT16MODE);
+}
+
+TToFltBatchResult
+str2bf16batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, uint16* dst, uintxx maxcount)
+{
+	CTB_ASSERT(src && delimiters && dst);
+
+	return parsebatch(src, total > 0 ? (uintxx) total : 0, delimiters, flags, dst, maxcount, BF16MODE);
+}
+
+
+/* ****************************************************************************
+ * JSON numbers
+ *************************************************************************** */
+
+#define INT64MAX 0x7fffffffffffffffull
 
+/* the largest uint64 is 1844674407370955161 * 10 + 5 */
+#define UINT64MAXDIV10 1844674407370955161ull
 
-static uint64 tobinary(const uint8*, int32, uint64, int32, uintxx);
 
-static eintxx
-parsefloat(const uint8* src, const uint8** end, uintxx mode, uint64* result)
+TToNumberResult
+jsontonumber(const uint8* src, intxx total, const uint8** end)
 {
-	int32 start;
-	int32 total;
 	uint32 c;
-	int32 i;
-	int32 isnegative;
-	int32 decimalpoint;
-	int32 e10;
-	int32 zcountf;
-	int32 zcounti;
+	int32 n;
+	int32 x;
+	int32 k;
+	uintxx isnegative;
+	uintxx isfloat;
 	uint64 significand;
-	eintxx r;
 	const uint8* s;
-	const struct TFLTType* f;
-
-	s = src;
-
-	/* Consume the white space */
-	while (ctb_isspace(s[0])) {
-		s++;
+	const uint8* e;
+	const uint8* start;
+	struct TToNumberResult result;
+	union {
+		flt64 f; uint64 u;
 	}
+	m;
+	CTB_ASSERT(src);
 
-	significand = 0;
-	e10 = 0;  /* Exponent */
-	decimalpoint = -1;
-
-	/* Number of zeros after the decimal point if the integral part is zero */
-	zcountf = 0;
-	zcounti = 0;  /* Number of zeros before the decimal point */
+	e = (s = src) + (total > 0 ? total : 0);
 
-	/* Check the sign */
 	isnegative = 0;
-	if (s[0] == 0x2d) {
+	if (s < e && s[0] == 0x2d) {
 		isnegative = 1;
 		s++;
 	}
-	else {
-		if (s[0] == 0x2b) {
-			s++;
-		}
+	if (s == e || ctb_isdigit(s[0]) == 0) {
+		goto L1;
 	}
 
-	f = flttype + mode;
-	if (ctb_isdigit(s[0]) == 0) {
-		if (s[0] == 0x2e) {
-			decimalpoint = 0;
-			s++;
+	significand = 0;
+	isfloat = 0;
+	n = 0;  /* significant digits */
+	x = 0;  /* exponent of the last digit */
 
+	/* integral part, a single zero or a run of digits */
+	start = s;
+	if (s[0] == 0x30) {
+		s++;
+		if (s < e && ctb_isdigit(s[0])) {
 			goto L1;
 		}
-
-		i = parsenan(s, f, result);
-		if (i) {
-			if (end) {
-				end[0] = s + i;
-			}
-			return 0;
-		}
-
-		if (end) {
-			end[0] = src;
-		}
-
-		result[0] = FLTNAN(f->sbits, f->ebits);
-		return STR2FLT_ENAN;
+		start = s;
 	}
-
-	/* 0s prefix */
-	while (s[0] == 0x30) {
-		zcounti++;
-		s++;
-	}
-
-	if (s[0] == 0x2e) {
-		decimalpoint = 0;
-		s++;
+	else {
+		n = readdigits(s, (uintxx) (e - s), 1, &significand, 0);
+		s += n;
 	}
 
-L1:
-	/* */
-	while (s[0] == 0x30) {
-		zcountf++;
+	/* fraction, the zeros that follow a zero integral part are not
+	 * significant */
+	if (s < e && s[0] == 0x2e) {
 		s++;
-	}
-
-	start = (int32) (s - (const uint8*) src);
-
-	/* Parse the first 19 digits */
-	for (total = 0; total < 19; s++) {
-		c = s[0];
-
-		if (ctb_isdigit(c) == 0) {
-			if (c == 0x2e) {
-				if (decimalpoint ^ -1) {
-					break;
-				}
+		if (s == e || ctb_isdigit(s[0]) == 0) {
+			goto L1;
+		}
+		isfloat = 1;
 
-				decimalpoint = total;
-				continue;
+		if (n == 0) {
+			for (; s < e && s[0] == 0x30; s++) {
+				x--;
 			}
-			break;
+			start = s;
 		}
-		significand = significand * 10 + (c - 0x30);
-		total++;
+		k = readdigits(s, (uintxx) (e - s), 1, &significand, n);
+		s += k;
+		n += k;
+		x -= k;
 	}
 
-	/* */
-	if (decimalpoint ^ -1) {
-		while (ctb_isdigit(s[0])) {
+	/* exponent */
+	if (s < e && (s[0] | 0x20) == 0x65) {
+		uintxx isnegativeexp;
+
+		s++;
+		isnegativeexp = 0;
+		if (s < e && (s[0] == 0x2d || s[0] == 0x2b)) {
+			isnegativeexp = s[0] == 0x2d;
 			s++;
-			total++;
 		}
-	}
-	else {
-		while (s[0]) {
-			if (ctb_isdigit(s[0]) == 0) {
-				if (s[0] == 0x2e) {
-					if (decimalpoint ^ -1) {
-						break;
-					}
+		if (s == e || ctb_isdigit(s[0]) == 0) {
+			goto L1;
+		}
+		isfloat = 1;
 
-					decimalpoint = total;
-					s++;
-					continue;
-				}
+		for (k = 0; s < e; s++) {
+			c = s[0];
+			if (ctb_isdigit(c) == 0) {
 				break;
 			}
-			total++;
-			s++;
+			if (k < 100000) {
+				k = k * 10 + (int32) (c - 0x30);
+			}
 		}
+		x += isnegativeexp ? -k : k;
 	}
 
-	if (total == 0) {
-		if (zcountf || zcounti) {
-			result[0] = 0;
-
-			/* Parse the exponent (if any) */
-			if (s[0] == 0x45 || s[0] == 0x65) {
-				int32 e[1];
+	result.error = STR2FLT_OK;
+	result.significand = significand;
+	result.digits = n;
+	result.exponent = n > 19 ? x + (n - 19) : x;
+	if (end)
+		end[0] = s;
 
-				s++;
-				s += (i = parseexponent(s, e));
-				if (i == 0)
-					s--;
+	/* integers */
+	if (isfloat == 0 && (isnegative == 0 || n != 0)) {
+		if (n <= 19) {
+			if (isnegative) {
+				if (significand <= INT64MAX + 1) {
+					result.type = STR2FLT_TINT64;
+					result.value.asi64 = (int64) (0 - significand);
+					return result;
+				}
+			}
+			else {
+				result.type = STR2FLT_TINT64;
+				if (significand > INT64MAX) {
+					result.type = STR2FLT_TUINT64;
+				}
+				result.value.asu64 = significand;
+				return result;
+			}
+		}
+		else {
+			if (n == 20 && isnegative == 0) {
+				c = start[19] - 0x30;
+				if (significand < UINT64MAXDIV10 ||
+					(significand == UINT64MAXDIV10 && c <= 5)) {
+					result.type = STR2FLT_TUINT64;
+					result.value.asu64 = significand * 10 + c;
+					return result;
+				}
 			}
-
-			if (end)
-				end[0] = s;
-			return 0;
 		}
-
-		if (end)
-			end[0] = src;
-
-		result[0] = FLTNAN(f->sbits, f->ebits);
-		return STR2FLT_ENAN;
-	}
-
-	if (decimalpoint == -1) {
-		decimalpoint = total;
 	}
 
-	/* We have an exponent */
-	if (s[0] == 0x45 || s[0] == 0x65) {
-		int32 e[1];
-
-		s++;
-		s += (i = parseexponent(s, e));
-		if (i == 0)
-			s--;
-		e10 = e[0];
+	m.u = 0;
+	if (n) {
+		m.u = tobinary(start, n, significand, x, FLT64MODE);
+		if (m.u == 0 || m.u == FLT64INF) {
+			result.error = STR2FLT_ERANGE;
+		}
 	}
+	if (isnegative)
+		m.u |= 1ull << 63;
 
-	/* Normalize the exponent */
-	e10 = e10 - (total - decimalpoint) - zcountf;
-
-	result[0] = tobinary(src + start, total, significand, e10, mode);
-	r = 0;
-	switch (mode) {
-		case FLT32MODE:
-			if (result[0] == 0 || result[0] == FLT32INF) {
-				r = STR2FLT_ERANGE;
-			}
-			if (isnegative)
-				result[0] |= 1ull << ((sizeof(uint32) << 3) - 1);
-			break;
+	result.type = STR2FLT_TFLT64;
+	result.value.asf64 = m.f;
+	return result;
 
-		case FLT64MODE:
-			if (result[0] == 0 || result[0] == FLT64INF) {
-				r = STR2FLT_ERANGE;
-			}
-			if (isnegative)
-				result[0] |= 1ull << ((sizeof(uint64) << 3) - 1);
-			break;
-	}
+L1:
 	if (end)
-		end[0] = s;
-	return r;
+		end[0] = src;
+
+	result.error = STR2FLT_ENAN;
+	result.type = STR2FLT_TINT64;
+	result.value.asu64 = 0;
+	result.significand = 0;
+	result.digits = 0;
+	result.exponent = 0;
+	return result;
 }
 
-static uint64
-tobinary(const uint8* start, int32 total, uint64 snd, int32 e10, uintxx mode)
-{
-	struct TFltResult r1;
-	struct TFltResult r2;
-	const struct TFLTType* f;
-
-	f = flttype + mode;
-	if (e10 == 0 && snd < (1ull << f->sbits)) {
-		switch (mode) {
-			case FLT32MODE: {
-				union {
-					flt32 f; uint32 u;
-				}
-				m;
-
-				m.f = (flt32) snd;
-				return (uint64) m.u;
-			}
-			break;
+#undef INT64MAX
+#undef UINT64MAXDIV10
 
-			case FLT64MODE: {
-				union {
-					flt64 f; uint64 u;
-				}
-				m;
 
-				m.f = (flt64) snd;
-				return (uint64) m.u;
-			}
-			break;
-		}
-	}
+/* ****************************************************************************
+ * Tables
+ *************************************************************************** */
 
-	if (total < 20) {
-		r1 = eisellemire(snd, e10, f);
-	}
-	else {
-		int32 ajustedexponent;
+#if defined(CTB_CFG_COMPACTTABLES)
 
-		ajustedexponent = (total + e10) - 19;
-		r1 = eisellemire(snd + 0, ajustedexponent, f);
-		r2 = eisellemire(snd + 1, ajustedexponent, f);
+/*
+ * Compressed table (as the compressed cache of Dragonbox): one entry of
+ * every 27 is stored, the rest are the stored one times 5^r (r < 27 fits in
+ * 64 bits) truncated to 128 bits. The truncation can be off by one or two
+ * from the full table, the error (plus one) is stored in 2 bits per entry,
+ * so the values are exactly those of the full table. */
 
-		if (r1.significand != r2.significand || r1.exponent != r2.exponent) {
-			r1.significand = -1ll;
-		}
-		else {
-			if (r2.significand == -1ll) {
-				r1.significand = -1ll;
-			}
-		}
-	}
+#define COMPACTSTEP 27
 
-	if (r1.significand == -1ll) {
-		struct TDecimal decimal;
+static const uint64 compactpowersoffive128[][2] = {
+	{0xeef453d6923bd65a, 0x113faa2906a13b3f},  /* -342 */
+	{0xc1069cd4eabe89f8, 0x999ec0bb696e840a},  /* -315 */
+	{0x9becce62836ac577, 0x4ee367f9430aec32},  /* -288 */
+	{0xfbe9141915d7a922, 0x4bf1ff9f0062baa8},  /* -261 */
+	{0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09},  /* -234 */
+	{0xa46116538d0deb78, 0x52d9be85f074e608},  /* -207 */
+	{0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073},  /* -180 */
+	{0xd686619ba27255a2, 0xc80a537b0efefebd},  /* -153 */
+	{0xad4ab7112eb3929d, 0x86c16c98d2c953c6},  /* -126 */
+	{0x8bfbea76c619ef36, 0x57eb4edb3c55b65a},  /* -99 */
+	{0xe2280b6c20dd5232, 0x25c6da63c38de1b0},  /* -72 */
+	{0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22},  /* -45 */
+	{0x9392ee8e921d5d07, 0x3aff322e62439fd0},  /* -18 */
+	{0xee6b280000000000, 0x0000000000000000},  /* 9 */
+	{0xc097ce7bc90715b3, 0x4b9f100000000000},  /* 36 */
+	{0x9b934c3b330c8577, 0x63cc55f49f88eb2f},  /* 63 */
+	{0xfb5878494ace3a5f, 0x04ab48a04065c723},  /* 90 */
+	{0xcb090c8001ab551c, 0x5cadf5bfd3072cc5},  /* 117 */
+	{0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6},  /* 144 */
+	{0x847c9b5d7c2e09b7, 0x69956135febada11},  /* 171 */
+	{0xd60b3bd56a5586f1, 0x8a71e223d8d3b074},  /* 198 */
+	{0xace73cbfdc0bfb7b, 0x636cc64d1001550b},  /* 225 */
+	{0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e},  /* 252 */
+	{0xe1a63853bbd26451, 0x5e7873f8a0396973},  /* 279 */
+	{0xb6472e511c81471d, 0xe0133fe4adf8e952}   /* 306 */
+};
 
-		parsedecimal(start, total, e10, &decimal);
-		r1 = decimaltobinary(&decimal, f);
-	}
-	return (uint64) (r1.significand | (r1.exponent << f->sbits));
-}
+static const uint64 powersoffive128errors[] = {
+	0x6a5a65656a6aa995ull, 0xa69a95559a9a5a56ull, 0x9565555699a9aa9aull,
+	0x565aa95a99a59656ull, 0xaaaaaa6aeba655a5ull, 0x9569a69a9a6a969aull,
+	0x595599a5a56956aaull, 0xa595aa5955555555ull, 0x55555555599aa9aaull,
+	0xab96655655555555ull, 0x44105555555541faull, 0x5555555555555555ull,
+	0x99aaa55555555555ull, 0xaaaa69a9a9696656ull, 0x55556aa5595aaa5aull,
+	0x5666655555955955ull, 0xa96aa96669a69a95ull, 0x9aaa5a5aaaa9a9aaull,
+	0x5565565aa56aaa6aull, 0xa969aaaaa5955696ull, 0x0000000000156aabull
+};
 
 
-struct TToFltResult
-str2flt64(const uint8* src, const uint8** end)
+static TUInt128
+getpowerof5(int32 index)
 {
-	struct TToFltResult result;
-	uint64 u;
-	union {
-		flt64 f; uint64 u;
-	}
-	m;
-	CTB_ASSERT(src);
-
-	result.error = parsefloat(src, end, FLT64MODE, &u);
+	TUInt128 a;
+	TUInt128 b;
+	uint64 m;
+	uint64 e;
+	int32 r;
+	int32 lz;
 
-	m.u = u;
-	result.value.asf64 = m.f;
-	return result;
-}
+	r = index % COMPACTSTEP;
+	a = ctb_u128(
+		compactpowersoffive128[index / COMPACTSTEP][0],
+		compactpowersoffive128[index / COMPACTSTEP][1]);
+	if (r == 0) {
+		return a;
+	}
 
-struct TToFltResult
-str2flt32(const uint8* src, const uint8** end)
-{
-	struct TToFltResult result;
-	uint64 u;
-	union {
-		flt32 f; uint32 u;
+	/* 192 bit product, the top 128 bits once normalized */
+	m = u64powersof5[r];
+	b = ctb_mul64to128(a.lo, m);
+	a = ctb_mul64to128(a.hi, m);
+	a.lo += b.hi;
+	if (a.lo < b.hi) {
+		a.hi++;
 	}
-	m;
-	CTB_ASSERT(src);
 
-	result.error = parsefloat(src, end, FLT32MODE, &u);
+	lz = countleadingzeros(a.hi);
+	a.hi = (a.hi << lz) | (a.lo >> (64 - lz));
+	a.lo = (a.lo << lz) | (b.lo >> (64 - lz));
 
-	m.u = (uint32) u;
-	result.value.asf32 = m.f;
-	return result;
+	e = (powersoffive128errors[index >> 5] >> ((index & 31) << 1)) & 3;
+	a = ctb_u128add(a, ctb_u128(0, e));
+	return ctb_u128sub(a, ctb_u128(0, 1));
 }
 
+#undef COMPACTSTEP
 
-/* ****************************************************************************
- * Tables
- *************************************************************************** */
+#else
 
 static const uint64 powersoffive128_[][2] = {
 	{0xeef453d6923bd65a, 0x113faa2906a13b3f},  /* -342 */
@@ -1553,15 +2272,15 @@ static const uint64 powersoffive128_[][2] = {
 	{0xcad2f7f5359a3b3e, 0x096ee45813a04330},  /* -29 */
 	{0xfd87b5f28300ca0d, 0x8bca9d6e188853fc},  /* -28 */
 	{0x9e74d1b791e07e48, 0x775ea264cf55347e},  /* -27 */
-	{0xc612062576589dda, 0x95364afe032a81a0},  /* -26 */
-	{0xf79687aed3eec551, 0x3a83ddbd83f52210},  /* -25 */
-	{0x9abe14cd44753b52, 0xc4926a9672793580},  /* -24 */
-	{0xc16d9a0095928a27, 0x75b7053c0f178400},  /* -23 */
-	{0xf1c90080baf72cb1, 0x5324c68b12dd6800},  /* -22 */
-	{0x971da05074da7bee, 0xd3f6fc16ebca8000},  /* -21 */
-	{0xbce5086492111aea, 0x88f4bb1ca6bd0000},  /* -20 */
-	{0xec1e4a7db69561a5, 0x2b31e9e3d0700000},  /* -19 */
-	{0x9392ee8e921d5d07, 0x3aff322e62600000},  /* -18 */
+	{0xc612062576589dda, 0x95364afe032a819e},  /* -26 */
+	{0xf79687aed3eec551, 0x3a83ddbd83f52205},  /* -25 */
+	{0x9abe14cd44753b52, 0xc4926a9672793543},  /* -24 */
+	{0xc16d9a0095928a27, 0x75b7053c0f178294},  /* -23 */
+	{0xf1c90080baf72cb1, 0x5324c68b12dd6339},  /* -22 */
+	{0x971da05074da7bee, 0xd3f6fc16ebca5e04},  /* -21 */
+	{0xbce5086492111aea, 0x88f4bb1ca6bcf585},  /* -20 */
+	{0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6},  /* -19 */
+	{0x9392ee8e921d5d07, 0x3aff322e62439fd0},  /* -18 */
 	{0xb877aa3236a4b449, 0x09befeb9fad487c3},  /* -17 */
 	{0xe69594bec44de15b, 0x4c2ebe687989a9b4},  /* -16 */
 	{0x901d7cf73ab0acd9, 0x0f9d37014bf60a11},  /* -15 */
@@ -1891,3 +2610,5 @@ static const uint64 powersoffive128_[][2] = {
 };
 
 static const uint64 (*powersoffive128)[2] = powersoffive128_;
+
+#endif
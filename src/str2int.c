@@ -17,6 +17,12 @@
 #include <ctoolbox/str2int.h>
 #include <ctoolbox/ctype.h>
 #include <ctoolbox/ckdint.h>
+#include <ctoolbox/ulog2.h>
+#include <ctoolbox/cpuinfo.h>
+
+#if defined(CTB_X86SIMD)
+	#include <immintrin.h>
+#endif
 
 
 static const uint8 hexamap[] = {
@@ -31,7 +37,7 @@ static const uint8 hexamap[] = {
 
 
 CTB_INLINE intxx
-getbase(const uint8** src, intxx base)
+getbase(const uint8** src, uintxx* size, intxx base)
 {
 	intxx c;
 	intxx b;
@@ -47,7 +53,7 @@ getbase(const uint8** src, intxx base)
 	}
 
 	s = src[0];
-	if (s[0] ^ 0x30) {
+	if (size[0] < 2 || (s[0] ^ 0x30)) {
 		if (base == 0) {
 			return 10;
 		}
@@ -64,40 +70,53 @@ getbase(const uint8** src, intxx base)
 	}
 
 	if (base) {
-		if (b) {
-			if (b == base) {
-				src[0] += 2;
-				return b;
-			}
+		if (b != base) {
+			return base;
 		}
-		return base;
 	}
 	if (b) {
+		/* the prefix must be followed by a valid digit */
+		if (size[0] < 3) {
+			goto L1;
+		}
+
 		c = s[2];
 		if (b ^ 0x10) {
-			if (c < 0x30 || c > (b + 0x30)) {
-				return 10;
+			if (c < 0x30 || c >= (b + 0x30)) {
+				goto L1;
 			}
 			src[0] += 2;
+			size[0] -= 2;
 			return b;
 		}
 		c = c | 0x20;
-		if ((c < 0x30 || c > 0x39) == 0 && (c < 0x61 || c > (b + 0x61)) == 0) {
-			return 10;
+		if ((c >= 0x30 && c <= 0x39) == 0 && (c >= 0x61 && c <= 0x66) == 0) {
+			goto L1;
 		}
 		src[0] += 2;
+		size[0] -= 2;
 		return b;
 	}
-	return 10;
+
+L1:
+	if (base == 0) {
+		return 10;
+	}
+	return base;
 }
 
+/* size used by the NUL terminated variants, the scan stops at the NUL */
+#define NOBOUND ((uintxx) -1)
+
+static eintxx parsepow2(const uint8*, uintxx, const uint8**, uintxx, uintxx, uint64*);
+
 
 static const uint8 maxdigits32[] = {
 	0, 0, 32, 21, 16, 14, 13, 12, 11, 11, 10, 10, 9, 9, 9, 9, 8,
 };
 
 static eintxx
-parseu32(const uint8* src, const uint8** end, intxx base, uint32* r)
+parseu32(const uint8* src, uintxx size, const uint8** end, intxx base, uint32* r)
 {
 	uintxx total;
 	uintxx limit;
@@ -110,9 +129,18 @@ parseu32(const uint8* src, const uint8** end, intxx base, uint32* r)
 	const uint8* s;
 
 	b = (uint32) base;
+	if ((b & (b - 1)) == 0) {
+		uint64 u;
+		eintxx e;
+
+		e = parsepow2(src, size, end, ctb_u32log2(b), 32, &u);
+		r[0] = (uint32) u;
+		return e;
+	}
+
 	if (b <= 10) {
 		m = 0x30 + b - 1;
-		for (s = src; s[0]; s++) {
+		for (s = src; size; s++, size--) {
 			if (s[0] < 0x30 || s[0] > m) {
 				break;
 			}
@@ -120,9 +148,9 @@ parseu32(const uint8* src, const uint8** end, intxx base, uint32* r)
 	}
 	else {
 		m = 0x61 + (b - 1 - 10);
-		for (s = src; s[0]; s++) {
+		for (s = src; size; s++, size--) {
 			c = s[0] | 0x20;
-			if ((c < 0x30 || c > 0x39) == 0 && (c < 0x61 || c > m) == 0) {
+			if ((c >= 0x30 && c <= 0x39) == 0 && (c >= 0x61 && c <= m) == 0) {
 				break;
 			}
 		}
@@ -136,7 +164,7 @@ parseu32(const uint8* src, const uint8** end, intxx base, uint32* r)
 	}
 
 	if (CTB_EXPECT0(src[0] == 0x30)) {
-		while (src[0] == 0x30) {
+		while (src < s && src[0] == 0x30) {
 			src++;
 		}
 
@@ -207,22 +235,23 @@ L1:
 	return STR2INT_ERANGE;
 }
 
-TToIntResult
-strtou32(const uint8* src, const uint8** end, intxx base)
+static TToIntResult
+tou32(const uint8* src, uintxx size, const uint8** end, intxx base)
 {
 	const uint8* s;
 	const uint8* e[1];
 	int32 isnegative;
 	uint32 u;
 	struct TToIntResult result;
-	CTB_ASSERT(src);
 
 	s = src;
-	while (ctb_isspace(s[0]))
+	while (size && ctb_isspace(s[0])) {
 		s++;
+		size--;
+	}
 
 	isnegative = 0;
-	for(; s[0]; s++) {
+	for (; size; s++, size--) {
 		switch (s[0]) {
 			case 0x2d: isnegative = 1; continue;
 			case 0x2b: isnegative = 0; continue;
@@ -231,7 +260,7 @@ strtou32(const uint8* src, const uint8** end, intxx base)
 	}
 
 	result.value.asu32 = 0;
-	base = getbase(&s, base);
+	base = getbase(&s, &size, base);
 	if (base == 0) {
 		if (end)
 			end[0] = src;
@@ -239,7 +268,7 @@ strtou32(const uint8* src, const uint8** end, intxx base)
 		return result;
 	}
 
-	if (parseu32(s, e, base, &u) == STR2INT_ERANGE) {
+	if (parseu32(s, size, e, base, &u) == STR2INT_ERANGE) {
 		if (end)
 			end[0] = e[0];
 
@@ -267,22 +296,23 @@ strtou32(const uint8* src, const uint8** end, intxx base)
 	return result;
 }
 
-TToIntResult
-strtoi32(const uint8* src, const uint8** end, intxx base)
+static TToIntResult
+toi32(const uint8* src, uintxx size, const uint8** end, intxx base)
 {
 	const uint8* s;
 	const uint8* e[1];
 	int32 isnegative;
 	uint32 u;
 	struct TToIntResult result;
-	CTB_ASSERT(src);
 
 	s = src;
-	while (ctb_isspace(s[0]))
+	while (size && ctb_isspace(s[0])) {
 		s++;
+		size--;
+	}
 
 	isnegative = 0;
-	for(; s[0]; s++) {
+	for (; size; s++, size--) {
 		switch (s[0]) {
 			case 0x2d: isnegative = 1; continue;
 			case 0x2b: isnegative = 0; continue;
@@ -291,7 +321,7 @@ strtoi32(const uint8* src, const uint8** end, intxx base)
 	}
 
 	result.value.asi32 = 0;
-	base = getbase(&s, base);
+	base = getbase(&s, &size, base);
 	if (base == 0) {
 		if (end)
 			end[0] = src;
@@ -299,7 +329,7 @@ strtoi32(const uint8* src, const uint8** end, intxx base)
 		return result;
 	}
 
-	if (parseu32(s, e, base, &u) == STR2INT_ERANGE) {
+	if (parseu32(s, size, e, base, &u) == STR2INT_ERANGE) {
 		u = 0xffffffff;
 		goto L1;
 	}
@@ -336,12 +366,41 @@ L1:
 }
 
 
+TToIntResult
+strtou32(const uint8* src, const uint8** end, intxx base)
+{
+	CTB_ASSERT(src);
+	return tou32(src, NOBOUND, end, base);
+}
+
+TToIntResult
+strtoi32(const uint8* src, const uint8** end, intxx base)
+{
+	CTB_ASSERT(src);
+	return toi32(src, NOBOUND, end, base);
+}
+
+TToIntResult
+strtou32n(const uint8* src, intxx total, const uint8** end, intxx base)
+{
+	CTB_ASSERT(src);
+	return tou32(src, total > 0 ? (uintxx) total : 0, end, base);
+}
+
+TToIntResult
+strtoi32n(const uint8* src, intxx total, const uint8** end, intxx base)
+{
+	CTB_ASSERT(src);
+	return toi32(src, total > 0 ? (uintxx) total : 0, end, base);
+}
+
+
 static const uint8 maxdigits64[] = {
 	0, 0, 64, 41, 32, 28, 25, 23, 22, 21, 20, 19, 18, 18, 17, 17, 16
 };
 
 static eintxx
-parseu64(const uint8* src, const uint8** end, intxx base, uint64* r)
+parseu64(const uint8* src, uintxx size, const uint8** end, intxx base, uint64* r)
 {
 	uintxx total;
 	uintxx limit;
@@ -354,9 +413,13 @@ parseu64(const uint8* src, const uint8** end, intxx base, uint64* r)
 	const uint8* s;
 
 	b = (uint32) base;
+	if ((b & (b - 1)) == 0) {
+		return parsepow2(src, size, end, ctb_u32log2(b), 64, r);
+	}
+
 	if (b <= 10) {
 		m = 0x30 + b - 1;
-		for (s = src; s[0]; s++) {
+		for (s = src; size; s++, size--) {
 			if (s[0] < 0x30 || s[0] > m) {
 				break;
 			}
@@ -364,9 +427,9 @@ parseu64(const uint8* src, const uint8** end, intxx base, uint64* r)
 	}
 	else {
 		m = 0x61 + (b - 1 - 10);
-		for (s = src; s[0]; s++) {
+		for (s = src; size; s++, size--) {
 			c = s[0] | 0x20;
-			if ((c < 0x30 || c > 0x39) == 0 && (c < 0x61 || c > m) == 0) {
+			if ((c >= 0x30 && c <= 0x39) == 0 && (c >= 0x61 && c <= m) == 0) {
 				break;
 			}
 		}
@@ -380,7 +443,7 @@ parseu64(const uint8* src, const uint8** end, intxx base, uint64* r)
 	}
 
 	if (CTB_EXPECT0(src[0] == 0x30)) {
-		while (src[0] == 0x30) {
+		while (src < s && src[0] == 0x30) {
 			src++;
 		}
 
@@ -455,22 +518,23 @@ L1:
 }
 
 
-TToIntResult
-strtou64(const uint8* src, const uint8** end, intxx base)
+static TToIntResult
+tou64(const uint8* src, uintxx size, const uint8** end, intxx base)
 {
 	const uint8* s;
 	const uint8* e[1];
 	int32 isnegative;
 	uint64 u;
 	struct TToIntResult result;
-	CTB_ASSERT(src);
 
 	s = src;
-	while (ctb_isspace(s[0]))
+	while (size && ctb_isspace(s[0])) {
 		s++;
+		size--;
+	}
 
 	isnegative = 0;
-	for(; s[0]; s++) {
+	for (; size; s++, size--) {
 		switch (s[0]) {
 			case 0x2d: isnegative = 1; continue;
 			case 0x2b: isnegative = 0; continue;
@@ -479,7 +543,7 @@ strtou64(const uint8* src, const uint8** end, intxx base)
 	}
 
 	result.value.asu64 = 0;
-	base = getbase(&s, base);
+	base = getbase(&s, &size, base);
 	if (base == 0) {
 		if (end)
 			end[0] = src;
@@ -487,7 +551,7 @@ strtou64(const uint8* src, const uint8** end, intxx base)
 		return result;
 	}
 
-	if (parseu64(s, e, base, &u) == STR2INT_ERANGE) {
+	if (parseu64(s, size, e, base, &u) == STR2INT_ERANGE) {
 		if (end)
 			end[0] = e[0];
 
@@ -499,6 +563,7 @@ strtou64(const uint8* src, const uint8** end, intxx base)
 		if (end)
 			end[0] = src;
 		result.error = STR2INT_ENAN;
+		return result;
 	}
 
 	if (end)
@@ -513,22 +578,23 @@ strtou64(const uint8* src, const uint8** end, intxx base)
 	return result;
 }
 
-TToIntResult
-strtoi64(const uint8* src, const uint8** end, intxx base)
+static TToIntResult
+toi64(const uint8* src, uintxx size, const uint8** end, intxx base)
 {
 	const uint8* s;
 	const uint8* e[1];
 	int32 isnegative;
 	uint64 u;
 	struct TToIntResult result;
-	CTB_ASSERT(src);
 
 	s = src;
-	while (ctb_isspace(s[0]))
+	while (size && ctb_isspace(s[0])) {
 		s++;
+		size--;
+	}
 
 	isnegative = 0;
-	for(; s[0]; s++) {
+	for (; size; s++, size--) {
 		switch (s[0]) {
 			case 0x2d: isnegative = 1; continue;
 			case 0x2b: isnegative = 0; continue;
@@ -537,7 +603,7 @@ strtoi64(const uint8* src, const uint8** end, intxx base)
 	}
 
 	result.value.asi64 = 0;
-	base = getbase(&s, base);
+	base = getbase(&s, &size, base);
 	if (base == 0) {
 		if (end)
 			end[0] = src;
@@ -545,7 +611,7 @@ strtoi64(const uint8* src, const uint8** end, intxx base)
 		return result;
 	}
 
-	if (parseu64(s, e, base, &u) == STR2INT_ERANGE) {
+	if (parseu64(s, size, e, base, &u) == STR2INT_ERANGE) {
 		u = 0xffffffffffffffff;
 		goto L1;
 	}
@@ -582,49 +648,363 @@ L1:
 }
 
 
-#if defined(__clang__) && defined(CTB_FASTUNALIGNED)
+TToIntResult
+strtou64(const uint8* src, const uint8** end, intxx base)
+{
+	CTB_ASSERT(src);
+	return tou64(src, NOBOUND, end, base);
+}
+
+TToIntResult
+strtoi64(const uint8* src, const uint8** end, intxx base)
+{
+	CTB_ASSERT(src);
+	return toi64(src, NOBOUND, end, base);
+}
+
+TToIntResult
+strtou64n(const uint8* src, intxx total, const uint8** end, intxx base)
+{
+	CTB_ASSERT(src);
+	return tou64(src, total > 0 ? (uintxx) total : 0, end, base);
+}
+
+TToIntResult
+strtoi64n(const uint8* src, intxx total, const uint8** end, intxx base)
+{
+	CTB_ASSERT(src);
+	return toi64(src, total > 0 ? (uintxx) total : 0, end, base);
+}
+
+
+#if defined(__clang__)
 	#pragma clang diagnostic push
 	#pragma clang diagnostic ignored "-Wcast-align"
 #endif
 
-static eintxx
-parsedecimal32(const uint8* src, uintxx total, const uint8** end, uint32* r)
+/*
+ * SWAR and SIMD digit conversion (the shared SWAR helpers are in
+ * private/swardigits.h). */
+#define CTB_INTERNAL_INCLUDE_GUARD
+	#include <ctoolbox/private/swardigits.h>
+#undef CTB_INTERNAL_INCLUDE_GUARD
+
+#if defined(SWARDIGITS)
+
+CTB_INLINE uint32
+nondigits4(uint32 v)
 {
-	uint32 n;
-	const uint8* s;
-	const uint8* p;
+	uint32 a;
+	uint32 b;
 
-	p = (s = src) + total;
-#if defined(CTB_FASTUNALIGNED)
-	for (; p - s >= 4; s += 4) {
-		uint32 v;
+	a = (v & 0xf0f0f0f0u);
+	b = (v + 0x06060606u) & 0xf0f0f0f0u;
+	return (a ^ 0x30303030u) | (b ^ 0x30303030u);
+}
 
-		v = ((const uint32*) s)[0];
-		if (((v & (v + 0x06060606u) & 0xf0f0f0f0u) == 0x30303030u) == 0) {
-			if (s[0] < 0x30 || s[0] > 0x39) {
-				goto L1;
+CTB_INLINE uint32
+convert4(const uint8* s)
+{
+	uint32 v;
+
+	v = ((const uint32*) s)[0] - 0x30303030u;
+	v = (v * 10) + (v >> 8);
+	return (((v & 0x00ff00ffu) * (1 + (100u << 16))) >> 16) & 0xffff;
+}
+
+/*
+ * Converts n (1 to 8) digits, 8 bytes must be readable. */
+CTB_INLINE uint32
+convertn(const uint8* s, uintxx n)
+{
+	uint64 v;
+
+	v = ((const uint64*) s)[0] - 0x3030303030303030ull;
+	return convert8(v << ((8 - n) << 3));
+}
+
+#endif
+
+#if defined(CTB_X86SIMD)
+
+static const uint8 shiftmask[] = {
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+
+/*
+ * Converts n (1 to 16) digits, 16 bytes must be readable. The digits are
+ * moved to the end of the register so the missing ones become leading
+ * zeros. */
+CTB_TARGET("sse4.1") static uint64
+convert16sse41(const uint8* s, uintxx n)
+{
+	__m128i a;
+
+	a = _mm_loadu_si128((const __m128i*) s);
+	a = _mm_sub_epi8(a, _mm_set1_epi8(0x30));
+	a = _mm_shuffle_epi8(a, _mm_loadu_si128((const __m128i*) (shiftmask + n)));
+
+	/* 16 digits -> 8 x 2 digits -> 4 x 4 digits -> 2 x 8 digits */
+	a = _mm_maddubs_epi16(a, _mm_setr_epi8(
+		10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+	a = _mm_madd_epi16(a, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+	a = _mm_packus_epi32(a, a);
+	a = _mm_madd_epi16(a, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+	return
+		(uint64) (uint32) _mm_cvtsi128_si32(a) * 100000000 +
+		(uint64) (uint32) _mm_extract_epi32(a, 1);
+}
+
+/*
+ * Finds the run of digits at the start of s and converts it, 16 bytes must
+ * be readable. Returns the length of the run, r is not set if all the 16
+ * characters are digits. */
+CTB_TARGET("sse4.1") static uintxx
+digitrun16sse41(const uint8* s, uint64* r)
+{
+	__m128i a;
+	__m128i b;
+	uint32 m;
+	uintxx n;
+
+	a = _mm_loadu_si128((const __m128i*) s);
+	a = _mm_sub_epi8(a, _mm_set1_epi8(0x30));
+	b = _mm_cmpeq_epi8(_mm_min_epu8(a, _mm_set1_epi8(9)), a);
+
+	m = (uint32) _mm_movemask_epi8(b) ^ 0xffff;
+	if (m == 0) {
+		return 16;
+	}
+	n = ctb_u32log2(m & (0 - m));
+
+	r[0] = convert16sse41(s, n);
+	return n;
+}
+
+/*
+ * Converts the fields that end inside blocks of 16 characters, the
+ * delimiters and the digits of a block are found with a single load. Stops
+ * at the first field that needs the scalar path (sign only, empty, too long
+ * or invalid) or when fewer than 32 characters are left. Returns the start
+ * of the next field. */
+CTB_TARGET("sse4.1") static const uint8*
+batch16sse41(const uint8* s, const uint8* p, const uint8* delimiters, uint64* dst, uintxx* count, uintxx maxcount)
+{
+	__m128i a;
+	__m128i b;
+	__m128i d;
+	uint32 dm;
+	uint32 gm;
+	uint32 fm;
+	uintxx o;
+	uintxx q;
+	uintxx j;
+	uint64 u;
+	const uint8* c;
+
+	j = count[0];
+	while (p - s >= 32) {
+		a = _mm_loadu_si128((const __m128i*) s);
+
+		d = _mm_setzero_si128();
+		for (c = delimiters; c[0]; c++) {
+			d = _mm_or_si128(d, _mm_cmpeq_epi8(a, _mm_set1_epi8((char) c[0])));
+		}
+		dm = (uint32) _mm_movemask_epi8(d);
+
+		b = _mm_sub_epi8(a, _mm_set1_epi8(0x30));
+		b = _mm_cmpeq_epi8(_mm_min_epu8(b, _mm_set1_epi8(9)), b);
+		gm = (uint32) _mm_movemask_epi8(b);
+
+		o = 0;
+		for (; dm; dm &= dm - 1) {
+			q = ctb_u32log2(dm & (0 - dm));
+
+			/* the characters of the field */
+			fm = (((uint32) 1 << q) - 1) & ~(((uint32) 1 << o) - 1);
+			if ((gm & fm) == fm && q != o) {
+				u = convert16sse41(s + o, q - o);
 			}
-			s++;
-			if (s[0] < 0x30 || s[0] > 0x39) {
-				goto L1;
+			else {
+				if ((gm & fm) != (fm & (fm - 1)) || q - o < 2) {
+					goto L1;
+				}
+				u = convert16sse41(s + o + 1, q - o - 1);
+				if (s[o] ^ 0x2b) {
+					if (s[o] ^ 0x2d) {
+						goto L1;
+					}
+					u = 0 - u;
+				}
 			}
-			s++;
-			if (s[0] < 0x30 || s[0] > 0x39) {
+
+			dst[j++] = u;
+			o = q + 1;
+			if (j == maxcount) {
 				goto L1;
 			}
-			s++;
-			goto L1;
 		}
+
+		if (o == 0) {
+			break;
+		}
+		s += o;
+	}
+	count[0] = j;
+	return s;
+
+L1:
+	count[0] = j;
+	return s + o;
+}
+
+#endif
+
+
+/*
+ * Power of two bases (2, 4, 8 and 16), the digits are packed with shifts
+ * and masks. */
+#if defined(SWARDIGITS)
+
+/*
+ * Sets the high bit of the bytes in the range [lo, hi]. */
+CTB_INLINE uint64
+inrange8(uint64 v, uint64 lo, uint64 hi)
+{
+	uint64 a;
+	uint64 b;
+
+	a = (v & 0x7f7f7f7f7f7f7f7full) + (0x80 - lo) * 0x0101010101010101ull;
+	b = (v & 0x7f7f7f7f7f7f7f7full) + (0x7f - hi) * 0x0101010101010101ull;
+	return a & ~b & ~v & 0x8080808080808080ull;
+}
+
+/*
+ * Returns a non zero byte for every character that is not a digit of the
+ * base (1 << shift). */
+CTB_INLINE uint64
+nonpow2digits8(uint64 v, uintxx shift)
+{
+	uint64 m;
+
+	if (shift == 4) {
+		m = inrange8(v, 0x30, 0x39) | inrange8(v | 0x2020202020202020ull, 0x61, 0x66);
+		return m ^ 0x8080808080808080ull;
+	}
+
+	m = (0xffu ^ ((1u << shift) - 1)) * 0x0101010101010101ull;
+	return (v & m) ^ 0x3030303030303030ull;
+}
+
+/*
+ * Converts 8 characters to digit values. */
+CTB_INLINE uint64
+pow2values8(uint64 v, uintxx shift)
+{
+	if (shift == 4) {
+		return (v & 0x0f0f0f0f0f0f0f0full) + ((v >> 6) & 0x0101010101010101ull) * 9;
 	}
+	return v - 0x3030303030303030ull;
+}
+
+/*
+ * Packs 8 digits (the first one in the low byte) of shift bits each. */
+CTB_INLINE uint64
+pack8(uint64 v, uintxx shift)
+{
+	v = pow2values8(v, shift);
+	v = ((v << (shift * 1)) + (v >> 8)) & 0x00ff00ff00ff00ffull;
+	v = ((v << (shift * 2)) + (v >> 16)) & 0x0000ffff0000ffffull;
+	v = ((v << (shift * 4)) + (v >> 32)) & 0x00000000ffffffffull;
+	return v;
+}
+
+/* _pext_u64 is only available on x86-64 */
+#if defined(CTB_X86SIMD) && (defined(__x86_64__) || defined(_M_X64))
+	#define PACKBMI2
 #endif
 
-	for (; p - s >= 1; s += 1) {
-		if (s[0] < 0x30 || s[0] > 0x39) {
+#if defined(PACKBMI2)
+
+/*
+ * Appends blocks of 8 digits to n, the digits of each block are gathered
+ * with a single pext. */
+CTB_TARGET("bmi2") static uint64
+pack8bmi2(const uint8* s, uintxx blocks, uintxx shift, uint64 n)
+{
+	uint64 m;
+	uint64 v;
+
+	m = ((1ull << shift) - 1) * 0x0101010101010101ull;
+	for (; blocks; blocks--) {
+		v = ctb_swap64(pow2values8(((const uint64*) s)[0], shift));
+		n = (n << (shift << 3)) | _pext_u64(v, m);
+		s += 8;
+	}
+	return n;
+}
+
+#endif
+
+#endif
+
+/* shift is log2 of the base, bits the size of the result (32 or 64) */
+static eintxx
+parsepow2(const uint8* src, uintxx size, const uint8** end, uintxx shift, uintxx bits, uint64* r)
+{
+	uintxx total;
+	uintxx j;
+#if defined(SWARDIGITS)
+	uintxx bounded;
+#endif
+	uint64 n;
+	uint32 c;
+	uint32 m;
+	const uint8* s;
+
+	s = src;
+#if defined(SWARDIGITS)
+	/* a real bound comes from a positive intxx, NOBOUND (less the prefix
+	 * and sign already skipped) is above it */
+	bounded = size <= (NOBOUND >> 1);
+	for (; size >= 8; size -= 8) {
+		uint64 v;
+
+		if (bounded == 0 && CANREAD8(s) == 0) {
 			break;
 		}
+
+		v = nonpow2digits8(((const uint64*) s)[0], shift);
+		if (v) {
+			s += firstbyte(v);
+			goto L1;
+		}
+		s += 8;
 	}
+#endif
 
-#if defined(CTB_FASTUNALIGNED)
+	if (shift == 4) {
+		for (; size; s++, size--) {
+			c = s[0] | 0x20;
+			if ((c >= 0x30 && c <= 0x39) == 0 && (c >= 0x61 && c <= 0x66) == 0) {
+				break;
+			}
+		}
+	}
+	else {
+		m = 0x30 + (1u << shift) - 1;
+		for (; size; s++, size--) {
+			if (s[0] < 0x30 || s[0] > m) {
+				break;
+			}
+		}
+	}
+
+#if defined(SWARDIGITS)
 L1:
 #endif
 	if (CTB_EXPECT0(s == src)) {
@@ -633,28 +1013,186 @@ L1:
 		r[0] = 0x00;
 		return STR2INT_ENAN;
 	}
+	if (end)
+		end[0] = s;
 
-	if (CTB_EXPECT0(src[0] == 0x30)) {
-		while (src[0] == 0x30) {
-			src++;
+	while (src < s && src[0] == 0x30) {
+		src++;
+	}
+
+	total = (uintxx) (s - src);
+	if (total == 0) {
+		r[0] = 0x00;
+		return 0;
+	}
+
+	/* the bits taken by the digits after the first one */
+	j = (total - 1) * shift;
+	if (CTB_EXPECT0(j + shift > bits)) {
+		if (j >= bits || (hexamap[src[0] - 0x30] >> (bits - j))) {
+			goto L2;
 		}
+	}
 
-		total = (uintxx) (s - src);
-		if (total == 0) {
-			r[0] = 0x00;
-			if (end)
-				end[0] = src;
+	n = 0;
+#if defined(SWARDIGITS)
+	j = total & 7;
+#else
+	j = total;
+#endif
+	for (; j; j--) {
+		n = (n << shift) | hexamap[*src++ - 0x30];
+	}
+
+#if defined(SWARDIGITS)
+	j = total >> 3;
+	if (j) {
+	#if defined(PACKBMI2)
+		if (ctb_cpufeatures() & CTB_CPU_BMI2) {
+			r[0] = pack8bmi2(src, j, shift, n);
 			return 0;
 		}
+	#endif
+		for (; j; j--) {
+			n = (n << (shift << 3)) | pack8(((const uint64*) src)[0], shift);
+			src += 8;
+		}
 	}
-	else {
-		total = (uintxx) (s - src);
-	}
+#endif
 
-	if (CTB_EXPECT1(total <= 10)) {
-		uint32 a;
-		uint32 b;
-		uint32 c;
+	r[0] = n;
+	return 0;
+
+L2:
+	r[0] = 0xffffffffffffffffull >> (64 - bits);
+	return STR2INT_ERANGE;
+}
+
+
+static eintxx
+parsedecimal32(const uint8* src, uintxx total, const uint8** end, uint32* r)
+{
+	uint32 n;
+	const uint8* s;
+	const uint8* p;
+
+	p = (s = src) + total;
+#if defined(SWARDIGITS)
+	for (; p - s >= 8; s += 8) {
+		uint64 m;
+
+		m = nondigits8(((const uint64*) s)[0]);
+		if (m) {
+			s += firstbyte(m);
+			goto L1;
+		}
+	}
+	if (p - s >= 4) {
+		uint32 m;
+
+		m = nondigits4(((const uint32*) s)[0]);
+		if (m) {
+			s += firstbyte(m);
+			goto L1;
+		}
+		s += 4;
+	}
+#elif defined(CTB_FASTUNALIGNED)
+	for (; p - s >= 4; s += 4) {
+		uint32 v;
+
+		v = ((const uint32*) s)[0];
+		if (((v & (v + 0x06060606u) & 0xf0f0f0f0u) == 0x30303030u) == 0) {
+			if (s[0] < 0x30 || s[0] > 0x39) {
+				goto L1;
+			}
+			s++;
+			if (s[0] < 0x30 || s[0] > 0x39) {
+				goto L1;
+			}
+			s++;
+			if (s[0] < 0x30 || s[0] > 0x39) {
+				goto L1;
+			}
+			s++;
+			goto L1;
+		}
+	}
+#endif
+
+	for (; p - s >= 1; s += 1) {
+		if (s[0] < 0x30 || s[0] > 0x39) {
+			break;
+		}
+	}
+
+#if defined(CTB_FASTUNALIGNED)
+L1:
+#endif
+	if (CTB_EXPECT0(s == src)) {
+		if (end)
+			end[0] = src;
+		r[0] = 0x00;
+		return STR2INT_ENAN;
+	}
+
+	if (CTB_EXPECT0(src[0] == 0x30)) {
+		while (src < s && src[0] == 0x30) {
+			src++;
+		}
+
+		total = (uintxx) (s - src);
+		if (total == 0) {
+			r[0] = 0x00;
+			if (end)
+				end[0] = src;
+			return 0;
+		}
+	}
+	else {
+		total = (uintxx) (s - src);
+	}
+
+	if (CTB_EXPECT1(total <= 10)) {
+#if defined(SWARDIGITS)
+		uint32 x;
+		uint32 v[1];
+		uintxx h;
+
+		/* the digits before the last group of 8 */
+		n = 0;
+		for (h = total; h > 8; h--) {
+			n = n * 10 + (*src++ - 0x30);
+		}
+
+		if (p - src >= 8) {
+			x = convertn(src, h);
+		}
+		else {
+			x = 0;
+			if (h >= 4) {
+				x = convert4(src);
+				src += 4;
+			}
+			for (; src < s; src++) {
+				x = x * 10 + (src[0] - 0x30);
+			}
+		}
+
+		if (total == 10) {
+			if (ckdu32_mul(n, 100000000, v))
+				goto L2;
+			if (ckdu32_add(v[0], x, v))
+				goto L2;
+			n = v[0];
+		}
+		else {
+			n = n * powersof10[h] + x;
+		}
+#else
+		uint32 a;
+		uint32 b;
+		uint32 c;
 		uint32 d;
 		uint32 v[1];
 
@@ -710,6 +1248,7 @@ L1:
 			}
 		}
 
+#endif
 		r[0] = (uint32) n;
 		if (end)
 			end[0] = s;
@@ -821,7 +1360,27 @@ parsedecimal64(const uint8* src, uintxx total, const uint8** end, uint64* r)
 	const uint8* p;
 
 	p = (s = src) + total;
-#if defined(CTB_FASTUNALIGNED)
+#if defined(SWARDIGITS)
+	for (; p - s >= 8; s += 8) {
+		uint64 m;
+
+		m = nondigits8(((const uint64*) s)[0]);
+		if (m) {
+			s += firstbyte(m);
+			goto L1;
+		}
+	}
+	if (p - s >= 4) {
+		uint32 m;
+
+		m = nondigits4(((const uint32*) s)[0]);
+		if (m) {
+			s += firstbyte(m);
+			goto L1;
+		}
+		s += 4;
+	}
+#elif defined(CTB_FASTUNALIGNED)
 	for (; p - s >= 4; s += 4) {
 		uint32 v;
 
@@ -861,7 +1420,7 @@ L1:
 	}
 
 	if (CTB_EXPECT0(src[0] == 0x30)) {
-		while (src[0] == 0x30) {
+		while (src < s && src[0] == 0x30) {
 			src++;
 		}
 
@@ -878,6 +1437,57 @@ L1:
 	}
 
 	if (CTB_EXPECT1(total <= 20)) {
+#if defined(SWARDIGITS)
+		uint64 x;
+		uint64 v[1];
+		uintxx h;
+
+		/* the digits before the last group of 16 */
+		n = 0;
+		for (h = total; h > 16; h--) {
+			n = n * 10 + (*src++ - 0x30);
+		}
+
+		if (h > 8) {
+#if defined(CTB_X86SIMD)
+			if (p - src >= 16 && (ctb_cpufeatures() & CTB_CPU_SSE41)) {
+				x = convert16sse41(src, h);
+				goto L3;
+			}
+#endif
+			x = convertn(src, h - 8);
+			x = convertn(src + h - 8, 8) + x * 100000000;
+		}
+		else {
+			if (p - src >= 8) {
+				x = convertn(src, h);
+			}
+			else {
+				x = 0;
+				if (h >= 4) {
+					x = convert4(src);
+					src += 4;
+				}
+				for (; src < s; src++) {
+					x = x * 10 + (uint64) (src[0] - 0x30);
+				}
+			}
+		}
+
+#if defined(CTB_X86SIMD)
+L3:
+#endif
+		if (total == 20) {
+			if (ckdu64_mul(n, 10000000000000000ull, v))
+				goto L2;
+			if (ckdu64_add(v[0], x, v))
+				goto L2;
+			n = v[0];
+		}
+		else {
+			n = n * 10000000000000000ull + x;
+		}
+#else
 		uint32 a;
 		uint32 b;
 		uint32 c;
@@ -971,6 +1581,7 @@ L1:
 			}
 		}
 
+#endif
 		r[0] = n;
 		if (end)
 			end[0] = s;
@@ -985,7 +1596,7 @@ L2:
 	return STR2INT_ERANGE;
 }
 
-#if defined(__clang__) && defined(CTB_FASTUNALIGNED)
+#if defined(__clang__)
 	#pragma clang diagnostic pop
 #endif
 
@@ -1080,6 +1691,491 @@ L1:
 }
 
 
+static const uint64 scaledpowers[] = {
+	1ull,
+	10ull,
+	100ull,
+	1000ull,
+	10000ull,
+	100000ull,
+	1000000ull,
+	10000000ull,
+	100000000ull,
+	1000000000ull,
+	10000000000ull,
+	100000000000ull,
+	1000000000000ull,
+	10000000000000ull,
+	100000000000000ull,
+	1000000000000000ull,
+	10000000000000000ull,
+	100000000000000000ull,
+	1000000000000000000ull,
+	10000000000000000000ull
+};
+
+TToIntResult
+strtoscaledi64(const uint8* src, intxx total, uintxx scale, const uint8** end)
+{
+	const uint8* s;
+	const uint8* e;
+	const uint8* p[1];
+	const uint8* f;
+	uintxx isnegative;
+	uintxx hasdigits;
+	uintxx overflow;
+	uintxx digit;
+	uintxx sticky;
+	uintxx n;
+	uint64 u;
+	uint64 d;
+	uint64 v[1];
+	struct TToIntResult result;
+	CTB_ASSERT(src && scale <= 19);
+
+	isnegative = 0;
+	e = (s = src) + total;
+	if (e > s) {
+		switch (s[0]) {
+			case 0x2d: isnegative = 1; s++; break;
+			case 0x2b: isnegative = 0; s++; break;
+		}
+	}
+
+	/* integer part */
+	overflow = parsedecimal64(s, (uintxx) (e - s), p, &u) == STR2INT_ERANGE;
+	hasdigits = p[0] != s;
+	s = p[0];
+
+	/* fractional part, the first scale digits are exact */
+	d = 0;
+	digit = 0;
+	sticky = 0;
+	if (s < e && s[0] == 0x2e) {
+		f = ++s;
+		n = (uintxx) (e - s);
+		if (n > scale) {
+			n = scale;
+		}
+		if (n >= 8) {
+			parsedecimal64(s, n, p, &d);
+			s = p[0];
+		}
+		else {
+			for (p[0] = s + n; s < p[0] && s[0] >= 0x30 && s[0] <= 0x39; s++) {
+				d = d * 10 + (uint64) (s[0] - 0x30);
+			}
+		}
+		d *= scaledpowers[scale - (uintxx) (s - f)];
+
+		/* round to nearest, ties to even */
+		if (s < e && s[0] >= 0x30 && s[0] <= 0x39) {
+			digit = (uintxx) (*s++ - 0x30);
+			for (; s < e && s[0] >= 0x30 && s[0] <= 0x39; s++) {
+				sticky |= (uintxx) (s[0] ^ 0x30);
+			}
+		}
+
+		if (s == f) {
+			if (hasdigits == 0) {
+				s--;
+			}
+		}
+		else {
+			hasdigits = 1;
+		}
+	}
+
+	if (CTB_EXPECT0(hasdigits == 0)) {
+		if (end)
+			end[0] = src;
+		result.error = STR2INT_ENAN;
+		result.value.asi64 = 0;
+		return result;
+	}
+	if (end)
+		end[0] = s;
+
+	if (CTB_EXPECT0(overflow))
+		goto L1;
+	if (ckdu64_mul(u, scaledpowers[scale], v))
+		goto L1;
+	if (ckdu64_add(v[0], d, v))
+		goto L1;
+	u = v[0];
+
+	if (digit > 5 || (digit == 5 && (sticky || (u & 1)))) {
+		if (ckdu64_add(u, 1, v))
+			goto L1;
+		u = v[0];
+	}
+	goto L2;
+
+L1:
+	u = 0xffffffffffffffffull;
+
+L2:
+	result.error = 0;
+	if (isnegative) {
+		if (u > (uint64) INT64_MIN) {
+			result.value.asi64 = INT64_MIN;
+			result.error = STR2INT_ERANGE;
+			return result;
+		}
+		result.value.asi64 = (int64) (0 - u);
+	}
+	else {
+		if (u > (uint64) INT64_MAX) {
+			result.value.asi64 = INT64_MAX;
+			result.error = STR2INT_ERANGE;
+			return result;
+		}
+		result.value.asi64 = +((int64) u);
+	}
+
+	return result;
+}
+
+
+CTB_INLINE uintxx
+isdelimiter(const uint8* delimiters, uintxx c)
+{
+	for (; delimiters[0]; delimiters++) {
+		if (delimiters[0] == c)
+			return 1;
+	}
+	return 0;
+}
+
+static TToIntBatchResult
+parsebatch(const uint8* src, uintxx total, const uint8* delimiters, uintxx flags, uint64* dst, uintxx maxcount, uintxx issigned)
+{
+	const uint8* s;
+	const uint8* p;
+	const uint8* f;
+	const uint8* e[1];
+	uintxx isnegative;
+	eintxx error;
+	uint64 u;
+	struct TToIntBatchResult result;
+#if defined(CTB_X86SIMD)
+	uintxx simd;
+
+	simd = ctb_cpufeatures() & CTB_CPU_SSE41;
+#endif
+
+	result.error = 0;
+	result.count = 0;
+	p = (s = src) + total;
+	if (total == 0) {
+		result.position = 0;
+		return result;
+	}
+
+	while (result.count < maxcount) {
+#if defined(CTB_X86SIMD)
+		if (simd && p - s >= 32 && (flags & STR2INT_SKIPSPACE) == 0) {
+			s = batch16sse41(s, p, delimiters, dst, &result.count, maxcount);
+			if (result.count == maxcount) {
+				break;
+			}
+		}
+#endif
+
+		if (flags & STR2INT_SKIPSPACE) {
+			while (s < p && ctb_isspace(s[0]) && isdelimiter(delimiters, s[0]) == 0)
+				s++;
+		}
+
+		f = s;
+		isnegative = 0;
+		if (s < p) {
+			switch (s[0]) {
+				case 0x2d: isnegative = 1; s++; break;
+				case 0x2b: isnegative = 0; s++; break;
+			}
+		}
+
+#if defined(CTB_X86SIMD)
+		/* the run of digits and the character that ends it in one load */
+		if (simd && p - s >= 16) {
+			uintxx n;
+
+			n = digitrun16sse41(s, &u);
+			if (CTB_EXPECT1(n != 0 && n != 16)) {
+				s += n;
+				goto L1;
+			}
+		}
+#endif
+
+		error = parsedecimal64(s, (uintxx) (p - s), e, &u);
+		if (CTB_EXPECT0(error != 0)) {
+			if (error == STR2INT_ERANGE) {
+				s = f;
+				goto L2;
+			}
+
+			if (s != f || (flags & STR2INT_ALLOWEMPTY) == 0) {
+				goto L2;
+			}
+			u = 0;
+		}
+		else {
+			s = e[0];
+		}
+
+#if defined(CTB_X86SIMD)
+L1:
+#endif
+		if (isnegative) {
+			if (issigned && u > (uint64) INT64_MIN) {
+				error = STR2INT_ERANGE;
+				s = f;
+				goto L2;
+			}
+			u = 0 - u;
+		}
+		else {
+			if (issigned && u > (uint64) INT64_MAX) {
+				error = STR2INT_ERANGE;
+				s = f;
+				goto L2;
+			}
+		}
+
+		if (flags & STR2INT_SKIPSPACE) {
+			while (s < p && ctb_isspace(s[0]) && isdelimiter(delimiters, s[0]) == 0)
+				s++;
+		}
+
+		if (s == p) {
+			dst[result.count++] = u;
+			result.position = total;
+			return result;
+		}
+		if (CTB_EXPECT0(isdelimiter(delimiters, s[0]) == 0)) {
+			error = STR2INT_ENAN;
+			goto L2;
+		}
+		dst[result.count++] = u;
+		s++;
+	}
+
+	result.position = (uintxx) (s - src);
+	return result;
+
+L2:
+	result.error = error;
+	result.position = (uintxx) (s - src);
+	return result;
+}
+
+TToIntBatchResult
+dcmltou64batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, uint64* dst, uintxx maxcount)
+{
+	CTB_ASSERT(src && delimiters && dst);
+
+	return parsebatch(src, total > 0 ? (uintxx) total : 0, delimiters, flags, dst, maxcount, 0);
+}
+
+TToIntBatchResult
+dcmltoi64batch(const uint8* src, intxx total, const uint8* delimiters, uintxx flags, int64* dst, uintxx maxcount)
+{
+	CTB_ASSERT(src && delimiters && dst);
+
+	return parsebatch(src, total > 0 ? (uintxx) total : 0, delimiters, flags, (uint64*) dst, maxcount, 1);
+}
+
+
+static const uint8 maxdigits128[] = {
+	0, 0, 128, 81, 64, 56, 50, 46, 43, 41, 39, 38, 36, 35, 34, 33, 32
+};
+
+static eintxx
+parseu128(const uint8* src, uintxx size, const uint8** end, intxx base, TUInt128* r)
+{
+	uintxx total;
+	uintxx chunk;
+	uintxx j;
+	uint32 m;
+	uint32 b;
+	uint32 c;
+	uint64 n;
+	uint64 p;
+	uint64 v[1];
+	TUInt128 x;
+	TUInt128 y;
+	const uint8* s;
+
+	b = (uint32) base;
+	if (b <= 10) {
+		m = 0x30 + b - 1;
+		for (s = src; size; s++, size--) {
+			if (s[0] < 0x30 || s[0] > m) {
+				break;
+			}
+		}
+	}
+	else {
+		m = 0x61 + (b - 1 - 10);
+		for (s = src; size; s++, size--) {
+			c = s[0] | 0x20;
+			if ((c >= 0x30 && c <= 0x39) == 0 && (c >= 0x61 && c <= m) == 0) {
+				break;
+			}
+		}
+	}
+
+	r[0] = ctb_u128(0, 0);
+	if (CTB_EXPECT0(s == src)) {
+		if (end)
+			end[0] = src;
+		return STR2INT_ENAN;
+	}
+	if (end)
+		end[0] = s;
+
+	while (src < s && src[0] == 0x30) {
+		src++;
+	}
+	if (CTB_EXPECT0((uintxx) (s - src) > maxdigits128[b])) {
+		goto L1;
+	}
+
+	/* the groups of digits that always fit in 64 bits */
+	chunk = (uintxx) maxdigits64[b] - 1;
+
+	x = ctb_u128(0, 0);
+	while (src < s) {
+		total = (uintxx) (s - src);
+		if (total > chunk) {
+			total = chunk;
+		}
+
+		if (b == 10) {
+			parsedecimal64(src, total, NULL, v);
+			n = v[0];
+			p = 1;
+			for (j = 0; j < total; j++) {
+				p *= 10;
+			}
+			src += total;
+		}
+		else {
+			n = 0;
+			p = 1;
+			for (j = 0; j < total; j++) {
+				c = src[0];
+				if (c > 0x39) {
+					c = hexamap[c - 0x30];
+				}
+				else {
+					c = c - 0x30;
+				}
+				n = n * b + c;
+				p = p * b;
+				src++;
+			}
+		}
+
+		/* x = x * p + n */
+		y = ctb_mul64to128(x.hi, p);
+		x = ctb_mul64to128(x.lo, p);
+		if (y.hi) {
+			goto L1;
+		}
+		x.hi += y.lo;
+		if (x.hi < y.lo) {
+			goto L1;
+		}
+		x.lo += n;
+		if (x.lo < n) {
+			if (++x.hi == 0) {
+				goto L1;
+			}
+		}
+	}
+
+	r[0] = x;
+	return 0;
+
+L1:
+	r[0] = ctb_u128(0xffffffffffffffffull, 0xffffffffffffffffull);
+	return STR2INT_ERANGE;
+}
+
+static TToU128Result
+tou128(const uint8* src, uintxx size, const uint8** end, intxx base)
+{
+	const uint8* s;
+	const uint8* e[1];
+	int32 isnegative;
+	TUInt128 u;
+	struct TToU128Result result;
+
+	s = src;
+	while (size && ctb_isspace(s[0])) {
+		s++;
+		size--;
+	}
+
+	isnegative = 0;
+	for (; size; s++, size--) {
+		switch (s[0]) {
+			case 0x2d: isnegative = 1; continue;
+			case 0x2b: isnegative = 0; continue;
+		}
+		break;
+	}
+
+	result.value = ctb_u128(0, 0);
+	base = getbase(&s, &size, base);
+	if (base == 0) {
+		if (end)
+			end[0] = src;
+		result.error = STR2INT_EBASE;
+		return result;
+	}
+
+	result.error = parseu128(s, size, e, base, &u);
+	if (CTB_EXPECT0(result.error != 0)) {
+		if (end) {
+			end[0] = e[0];
+			if (result.error == STR2INT_ENAN)
+				end[0] = src;
+		}
+		result.value = u;
+		return result;
+	}
+
+	if (end)
+		end[0] = e[0];
+
+	if (isnegative) {
+		u = ctb_u128sub(ctb_u128(0, 0), u);
+	}
+
+	result.value = u;
+	return result;
+}
+
+
+TToU128Result
+strtou128(const uint8* src, const uint8** end, intxx base)
+{
+	CTB_ASSERT(src);
+	return tou128(src, NOBOUND, end, base);
+}
+
+TToU128Result
+strtou128n(const uint8* src, intxx total, const uint8** end, intxx base)
+{
+	CTB_ASSERT(src);
+	return tou128(src, total > 0 ? (uintxx) total : 0, end, base);
+}
+
+
 static eintxx
 parsehexa32(const uint8* src, uintxx total, const uint8** end, uint32* r)
 {
@@ -1092,7 +2188,7 @@ parsehexa32(const uint8* src, uintxx total, const uint8** end, uint32* r)
 		uint32 c;
 
 		c = s[0] | 0x20;
-		if ((c < 0x30 || c > 0x39) == 0 && (c < 0x61 || c > 0x66) == 0) {
+		if ((c >= 0x30 && c <= 0x39) == 0 && (c >= 0x61 && c <= 0x66) == 0) {
 			break;
 		}
 	}
@@ -1105,7 +2201,7 @@ parsehexa32(const uint8* src, uintxx total, const uint8** end, uint32* r)
 	}
 
 	if (CTB_EXPECT0(src[0] == 0x30)) {
-		while (src[0] == 0x30) {
+		while (src < s && src[0] == 0x30) {
 			src++;
 		}
 
@@ -1291,7 +2387,7 @@ parsehexa64(const uint8* src, uintxx total, const uint8** end, uint64* r)
 		uint32 c;
 
 		c = s[0] | 0x20;
-		if ((c < 0x30 || c > 0x39) == 0 && (c < 0x61 || c > 0x66) == 0) {
+		if ((c >= 0x30 && c <= 0x39) == 0 && (c >= 0x61 && c <= 0x66) == 0) {
 			break;
 		}
 	}
@@ -1304,7 +2400,7 @@ parsehexa64(const uint8* src, uintxx total, const uint8** end, uint64* r)
 	}
 
 	if (CTB_EXPECT0(src[0] == 0x30)) {
-		while (src[0] == 0x30) {
+		while (src < s && src[0] == 0x30) {
 			src++;
 		}
 
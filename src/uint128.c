@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ctoolbox/uint128.h>
+#include <ctoolbox/ulog2.h>
+
+
+#if !defined(CTB_HAS_INT128)
+
+/*
+ * Divides the 128 bit number u1:u0 by v, u1 must be less than v.
+ * Based on divlu from "Hacker's Delight" by Henry S. Warren. */
+static uint64
+divlu(uint64 u1, uint64 u0, uint64 v, uint64* r)
+{
+	uint64 vn1;
+	uint64 vn0;
+	uint64 un1;
+	uint64 un0;
+	uint64 un32;
+	uint64 un21;
+	uint64 un10;
+	uint64 q1;
+	uint64 q0;
+	uint64 rhat;
+	uintxx s;
+
+	/* normalize the divisor */
+	s = 63 ^ ctb_u64log2(v);
+	v <<= s;
+	vn1 = v >> 32;
+	vn0 = v & 0xffffffff;
+
+	un32 = u1 << s;
+	if (s) {
+		un32 |= u0 >> (64 - s);
+	}
+	un10 = u0 << s;
+	un1 = un10 >> 32;
+	un0 = un10 & 0xffffffff;
+
+	q1 = un32 / vn1;
+	rhat = un32 - q1 * vn1;
+	while (q1 >> 32 || q1 * vn0 > ((rhat << 32) | un1)) {
+		q1--;
+		rhat += vn1;
+		if (rhat >> 32) {
+			break;
+		}
+	}
+
+	un21 = ((un32 << 32) | un1) - q1 * v;
+	q0 = un21 / vn1;
+	rhat = un21 - q0 * vn1;
+	while (q0 >> 32 || q0 * vn0 > ((rhat << 32) | un0)) {
+		q0--;
+		rhat += vn1;
+		if (rhat >> 32) {
+			break;
+		}
+	}
+
+	r[0] = (((un21 << 32) | un0) - q0 * v) >> s;
+	return (q1 << 32) | q0;
+}
+
+#endif
+
+
+TUInt128
+ctb_u128divmod64(TUInt128 n, uint64 d, uint64* r)
+{
+#if defined(CTB_HAS_INT128)
+	__uint128_t a;
+	CTB_ASSERT(d);
+
+	a = ctb_u128tonative(n);
+	if (r)
+		r[0] = (uint64) (a % d);
+	return ctb_u128fromnative(a / d);
+#else
+	TUInt128 q;
+	uint64 m[1];
+	CTB_ASSERT(d);
+
+	q.hi = n.hi / d;
+	q.lo = divlu(n.hi % d, n.lo, d, m);
+	if (r)
+		r[0] = m[0];
+	return q;
+#endif
+}
+
+TUInt128
+ctb_u128divmod(TUInt128 n, TUInt128 d, TUInt128* r)
+{
+#if defined(CTB_HAS_INT128)
+	__uint128_t a;
+	__uint128_t b;
+	CTB_ASSERT(d.hi || d.lo);
+
+	a = ctb_u128tonative(n);
+	b = ctb_u128tonative(d);
+	if (r)
+		r[0] = ctb_u128fromnative(a % b);
+	return ctb_u128fromnative(a / b);
+#else
+	TUInt128 q;
+	TUInt128 m;
+	uint64 v;
+	uint64 x[1];
+	uintxx s;
+	CTB_ASSERT(d.hi || d.lo);
+
+	if (d.hi == 0) {
+		q = ctb_u128divmod64(n, d.lo, x);
+		if (r)
+			r[0] = ctb_u128(0, x[0]);
+		return q;
+	}
+
+	/*
+	 * The quotient fits in 64 bits, estimate it from the normalized high
+	 * half of the divisor (it is either exact or one too large). */
+	s = 63 ^ ctb_u64log2(d.hi);
+	v = ctb_u128shl(d, s).hi;
+
+	q.hi = 0;
+	q.lo = divlu(n.hi >> 1, (n.lo >> 1) | (n.hi << 63), v, x) >> (63 - s);
+	if (q.lo) {
+		q.lo--;
+	}
+
+	m = ctb_u128sub(n, ctb_u128mul(q, d));
+	if (ctb_u128cmp(m, d) >= 0) {
+		m = ctb_u128sub(m, d);
+		q.lo++;
+	}
+
+	if (r)
+		r[0] = m;
+	return q;
+#endif
+}
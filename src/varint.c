@@ -0,0 +1,1254 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ctoolbox/varint.h>
+#include <ctoolbox/cpuinfo.h>
+
+#if defined(CTB_X86SIMD)
+	#include <immintrin.h>
+#endif
+
+
+#if defined(CTB_X86SIMD)
+
+/* Stream VByte: pshufb masks and data sizes for each control byte */
+static const uint8 svbshuffle[256][16] = {
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x09, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80, 0x09, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x09, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x0a, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80, 0x0a, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x09, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x0a, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x0b, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x09, 0x0a, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0a, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0a, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x0a, 0x0b, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0a, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0a, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80, 0x0a, 0x0b, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0a, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x0a, 0x0b, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x0b, 0x0c, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x09, 0x0a, 0x0b, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0a, 0x0b, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0a, 0x0b, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x0a, 0x0b, 0x0c, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0a, 0x0b, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0a, 0x0b, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80, 0x0a, 0x0b, 0x0c, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0a, 0x0b, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x0a, 0x0b, 0x0c, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x0b, 0x0c, 0x0d, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x09, 0x0a, 0x0b, 0x0c},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0a, 0x0b, 0x0c},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0a, 0x0b, 0x0c},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x0a, 0x0b, 0x0c, 0x0d},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x08},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0a, 0x0b, 0x0c},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0a, 0x0b, 0x0c},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80, 0x0a, 0x0b, 0x0c, 0x0d},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0a, 0x0b, 0x0c},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x0a, 0x0b, 0x0c, 0x0d},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x0b, 0x0c, 0x0d, 0x0e},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f}
+};
+
+static const uint8 svblength[256] = {
+	 4,  5,  6,  7,  5,  6,  7,  8,  6,  7,  8,  9,  7,  8,  9, 10,
+	 5,  6,  7,  8,  6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,
+	 6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12,
+	 7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+	 5,  6,  7,  8,  6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,
+	 6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12,
+	 7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+	 8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14,
+	 6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12,
+	 7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+	 8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14,
+	 9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14, 12, 13, 14, 15,
+	 7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+	 8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14,
+	 9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14, 12, 13, 14, 15,
+	10, 11, 12, 13, 11, 12, 13, 14, 12, 13, 14, 15, 13, 14, 15, 16
+};
+
+
+/* Masked VByte: pshufb masks, number of integers and bytes used for the stop
+ * bits of 8 bytes */
+static const uint8 mvbshuffle[256][16] = {
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+	{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}
+};
+
+static const uint8 mvbcount[256] = {
+	0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+	0, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 4,
+	0, 1, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 4,
+	0, 3, 3, 4, 3, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4,
+	0, 1, 1, 2, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 4,
+	0, 3, 3, 4, 3, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4,
+	0, 1, 3, 4, 3, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4,
+	0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 1, 1, 2, 1, 2, 2, 3, 2, 3, 3, 4, 3, 4, 4, 4,
+	0, 3, 3, 4, 3, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4,
+	0, 1, 3, 4, 3, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4,
+	0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 1, 1, 2, 3, 4, 4, 4, 3, 4, 4, 4, 4, 4, 4, 4,
+	0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4
+};
+
+static const uint8 mvbconsumed[256] = {
+	0, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+	0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4,
+	0, 1, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4,
+	0, 6, 6, 6, 6, 6, 6, 5, 6, 6, 6, 5, 6, 5, 5, 4,
+	0, 1, 2, 2, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 4,
+	0, 7, 7, 7, 7, 7, 7, 5, 7, 7, 7, 5, 7, 5, 5, 4,
+	0, 1, 7, 7, 7, 7, 7, 6, 7, 7, 7, 6, 7, 6, 6, 4,
+	0, 7, 7, 6, 7, 6, 6, 5, 7, 6, 6, 5, 6, 5, 5, 4,
+	0, 1, 2, 2, 3, 3, 3, 3, 8, 8, 8, 8, 8, 8, 8, 4,
+	0, 8, 8, 8, 8, 8, 8, 5, 8, 8, 8, 5, 8, 5, 5, 4,
+	0, 1, 8, 8, 8, 8, 8, 6, 8, 8, 8, 6, 8, 6, 6, 4,
+	0, 8, 8, 6, 8, 6, 6, 5, 8, 6, 6, 5, 6, 5, 5, 4,
+	0, 1, 2, 2, 8, 8, 8, 7, 8, 8, 8, 7, 8, 7, 7, 4,
+	0, 8, 8, 7, 8, 7, 7, 5, 8, 7, 7, 5, 7, 5, 5, 4,
+	0, 1, 8, 7, 8, 7, 7, 6, 8, 7, 7, 6, 7, 6, 6, 4,
+	0, 7, 7, 6, 7, 6, 6, 5, 7, 6, 6, 5, 6, 5, 5, 4
+};
+#endif
+
+
+/* ****************************************************************************
+ * LEB128
+ *************************************************************************** */
+
+uintxx
+ctb_varintencodeu32(uint32 n, uint8* dst)
+{
+	uint8* d;
+	CTB_ASSERT(dst);
+
+	for (d = dst; n >= 0x80; n >>= 7) {
+		*d++ = (uint8) (n | 0x80);
+	}
+	*d++ = (uint8) n;
+	return (uintxx) (d - dst);
+}
+
+uintxx
+ctb_varintencodeu64(uint64 n, uint8* dst)
+{
+	uint8* d;
+	CTB_ASSERT(dst);
+
+	for (d = dst; n >= 0x80; n >>= 7) {
+		*d++ = (uint8) (n | 0x80);
+	}
+	*d++ = (uint8) n;
+	return (uintxx) (d - dst);
+}
+
+uintxx
+ctb_varintencodei32(int32 n, uint8* dst)
+{
+	return ctb_varintencodei64(n, dst);
+}
+
+uintxx
+ctb_varintencodei64(int64 n, uint8* dst)
+{
+	uint64 u;
+	uint64 s;
+	uint32 c;
+	uint8* d;
+	CTB_ASSERT(dst);
+
+	/* arithmetic shift without relying on the behavior of >> on negative
+	 * numbers */
+	u = (uint64) n;
+	s = 0;
+	if (n < 0) {
+		s = ~(0xffffffffffffffffull >> 7);
+	}
+
+	d = dst;
+	for (;;) {
+		c = (uint32) (u & 0x7f);
+		u = (u >> 7) | s;
+		if ((u == 0 && (c & 0x40) == 0) || (s && u == 0xffffffffffffffffull && (c & 0x40))) {
+			break;
+		}
+		*d++ = (uint8) (c | 0x80);
+	}
+	*d++ = (uint8) c;
+	return (uintxx) (d - dst);
+}
+
+/*
+ * Reads at most maxsize bytes, r holds the raw bits (bits beyond the 64th
+ * are dropped, the callers check the last byte). */
+static eintxx
+decodescalar(const uint8* src, uintxx size, uintxx maxsize, uint64* r, uintxx* total)
+{
+	uintxx j;
+	uint64 n;
+	uint32 c;
+
+	if (size > maxsize) {
+		size = maxsize;
+	}
+
+	n = 0;
+	for (j = 0; j < size; j++) {
+		c = src[j];
+		n |= (uint64) (c & 0x7f) << (j * 7);
+		if ((c & 0x80) == 0) {
+			r[0] = n;
+			total[0] = j + 1;
+			return VARINT_OK;
+		}
+	}
+
+	if (size == maxsize) {
+		return VARINT_ERANGE;
+	}
+	return VARINT_ESIZE;
+}
+
+/*
+ * Same as above when maxsize bytes are readable, without the bound checks.
+ * Returns the length or zero if the integer is longer. */
+CTB_INLINE uintxx
+decodefast(const uint8* src, uintxx maxsize, uint64* r)
+{
+	uintxx j;
+	uint64 n;
+	uint32 c;
+
+	n = 0;
+	for (j = 0; j < maxsize; j++) {
+		c = src[j];
+		n |= (uint64) (c & 0x7f) << (j * 7);
+		if ((c & 0x80) == 0) {
+			r[0] = n;
+			return j + 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Same as above for an uint32 (5 bytes readable), unrolled so the length is
+ * not a loop exit but a predictable branch. Returns zero if the integer is
+ * longer or out of range. */
+CTB_INLINE uintxx
+decodefast32(const uint8* src, uint32* r)
+{
+	uint32 c;
+	uint32 n;
+
+	c = src[0];
+	n = c & 0x7f;
+	if (c & 0x80) {
+		c = src[1];
+		n |= (c & 0x7f) << 7;
+		if (c & 0x80) {
+			c = src[2];
+			n |= (c & 0x7f) << 14;
+			if (c & 0x80) {
+				c = src[3];
+				n |= (c & 0x7f) << 21;
+				if (c & 0x80) {
+					c = src[4];
+					if (CTB_EXPECT0(c > 0x0f)) {
+						return 0;
+					}
+					r[0] = n | (c << 28);
+					return 5;
+				}
+				r[0] = n;
+				return 4;
+			}
+			r[0] = n;
+			return 3;
+		}
+		r[0] = n;
+		return 2;
+	}
+	r[0] = n;
+	return 1;
+}
+
+eintxx
+ctb_varintdecodeu32(const uint8* src, uintxx size, uint32* r, const uint8** end)
+{
+	uintxx n;
+	uint64 v;
+	eintxx e;
+	CTB_ASSERT(src && r);
+
+	r[0] = 0;
+	e = decodescalar(src, size, VARINT_MAXSIZE32, &v, &n);
+	if (e == 0 && (v >> 32) != 0) {
+		e = VARINT_ERANGE;
+	}
+	if (CTB_EXPECT0(e != 0)) {
+		if (end)
+			end[0] = src;
+		return e;
+	}
+
+	r[0] = (uint32) v;
+	if (end)
+		end[0] = src + n;
+	return VARINT_OK;
+}
+
+eintxx
+ctb_varintdecodeu64(const uint8* src, uintxx size, uint64* r, const uint8** end)
+{
+	uintxx n;
+	uint64 v;
+	eintxx e;
+	CTB_ASSERT(src && r);
+
+	r[0] = 0;
+	e = decodescalar(src, size, VARINT_MAXSIZE64, &v, &n);
+	if (e == 0 && n == VARINT_MAXSIZE64 && src[9] > 0x01) {
+		e = VARINT_ERANGE;
+	}
+	if (CTB_EXPECT0(e != 0)) {
+		if (end)
+			end[0] = src;
+		return e;
+	}
+
+	r[0] = v;
+	if (end)
+		end[0] = src + n;
+	return VARINT_OK;
+}
+
+eintxx
+ctb_varintdecodei32(const uint8* src, uintxx size, int32* r, const uint8** end)
+{
+	uintxx n;
+	uint64 v;
+	eintxx e;
+	CTB_ASSERT(src && r);
+
+	r[0] = 0;
+	e = decodescalar(src, size, VARINT_MAXSIZE32, &v, &n);
+	if (e == 0) {
+		/* sign extension */
+		if (src[n - 1] & 0x40) {
+			v |= 0xffffffffffffffffull << (n * 7);
+		}
+		if ((int64) v < INT32_MIN || (int64) v > INT32_MAX) {
+			e = VARINT_ERANGE;
+		}
+	}
+	if (CTB_EXPECT0(e != 0)) {
+		if (end)
+			end[0] = src;
+		return e;
+	}
+
+	r[0] = (int32) (int64) v;
+	if (end)
+		end[0] = src + n;
+	return VARINT_OK;
+}
+
+eintxx
+ctb_varintdecodei64(const uint8* src, uintxx size, int64* r, const uint8** end)
+{
+	uintxx n;
+	uint64 v;
+	eintxx e;
+	CTB_ASSERT(src && r);
+
+	r[0] = 0;
+	e = decodescalar(src, size, VARINT_MAXSIZE64, &v, &n);
+	if (e == 0) {
+		if (n == VARINT_MAXSIZE64) {
+			/* the last byte only holds the sign */
+			if (src[9] != 0x00 && src[9] != 0x7f) {
+				e = VARINT_ERANGE;
+			}
+		}
+		else {
+			if (src[n - 1] & 0x40) {
+				v |= 0xffffffffffffffffull << (n * 7);
+			}
+		}
+	}
+	if (CTB_EXPECT0(e != 0)) {
+		if (end)
+			end[0] = src;
+		return e;
+	}
+
+	r[0] = (int64) v;
+	if (end)
+		end[0] = src + n;
+	return VARINT_OK;
+}
+
+
+/* ****************************************************************************
+ * LEB128 batch decoding
+ *************************************************************************** */
+
+#if defined(__clang__)
+	#pragma clang diagnostic push
+	#pragma clang diagnostic ignored "-Wcast-align"
+#endif
+
+#if defined(CTB_X86SIMD)
+
+/*
+ * Masked VByte: the stop bits of 8 bytes index a table with the shuffle that
+ * moves the next integers (up to 4, of at most 4 bytes each) to 32 bit lanes,
+ * the 7 bit groups are then merged with two multiply-adds. Runs of 16 single
+ * byte integers are widened directly. Returns the number of integers decoded,
+ * total is updated with the bytes used. Runs while 16 bytes are readable and
+ * 16 integers fit, stops at the first integer longer than 4 bytes. */
+CTB_TARGET("ssse3") static uintxx
+mvbdecodessse3(const uint8* src, uintxx size, uint32* dst, uintxx count, uintxx* total)
+{
+	uintxx j;
+	uintxx k;
+	uint32 c;
+	uint32 m;
+	__m128i a;
+	__m128i l;
+	__m128i h;
+	__m128i z;
+
+	z = _mm_setzero_si128();
+	j = 0;
+	k = 0;
+	while (size - k >= 16 && count - j >= 16) {
+		a = _mm_loadu_si128((const __m128i*) (src + k));
+		m = (uint32) _mm_movemask_epi8(a);
+		if (m == 0) {
+			l = _mm_unpacklo_epi8(a, z);
+			h = _mm_unpackhi_epi8(a, z);
+			_mm_storeu_si128((__m128i*) (dst + j + 0x00), _mm_unpacklo_epi16(l, z));
+			_mm_storeu_si128((__m128i*) (dst + j + 0x04), _mm_unpackhi_epi16(l, z));
+			_mm_storeu_si128((__m128i*) (dst + j + 0x08), _mm_unpacklo_epi16(h, z));
+			_mm_storeu_si128((__m128i*) (dst + j + 0x0c), _mm_unpackhi_epi16(h, z));
+			j += 16;
+			k += 16;
+			continue;
+		}
+
+		c = ~m & 0xff;
+		if (CTB_EXPECT0(mvbcount[c] == 0)) {
+			break;
+		}
+		a = _mm_shuffle_epi8(a, _mm_loadu_si128((const __m128i*) mvbshuffle[c]));
+		a = _mm_and_si128(a, _mm_set1_epi8(0x7f));
+		a = _mm_maddubs_epi16(_mm_set1_epi16((int16) 0x8001), a);
+		a = _mm_madd_epi16(a, _mm_set1_epi32(0x40000001));
+		_mm_storeu_si128((__m128i*) (dst + j), a);
+		j += mvbcount[c];
+		k += mvbconsumed[c];
+	}
+
+	total[0] = k;
+	return j;
+}
+
+CTB_TARGET("ssse3") static uintxx
+mvbdecode64ssse3(const uint8* src, uintxx size, uint64* dst, uintxx count, uintxx* total)
+{
+	uintxx j;
+	uintxx k;
+	uint32 c;
+	uint32 m;
+	__m128i a;
+	__m128i l;
+	__m128i h;
+	__m128i z;
+
+	z = _mm_setzero_si128();
+	j = 0;
+	k = 0;
+	while (size - k >= 16 && count - j >= 16) {
+		a = _mm_loadu_si128((const __m128i*) (src + k));
+		m = (uint32) _mm_movemask_epi8(a);
+		if (m == 0) {
+			l = _mm_unpacklo_epi8(a, z);
+			h = _mm_unpackhi_epi8(a, z);
+			a = _mm_unpacklo_epi16(l, z);
+			_mm_storeu_si128((__m128i*) (dst + j + 0x00), _mm_unpacklo_epi32(a, z));
+			_mm_storeu_si128((__m128i*) (dst + j + 0x02), _mm_unpackhi_epi32(a, z));
+			a = _mm_unpackhi_epi16(l, z);
+			_mm_storeu_si128((__m128i*) (dst + j + 0x04), _mm_unpacklo_epi32(a, z));
+			_mm_storeu_si128((__m128i*) (dst + j + 0x06), _mm_unpackhi_epi32(a, z));
+			a = _mm_unpacklo_epi16(h, z);
+			_mm_storeu_si128((__m128i*) (dst + j + 0x08), _mm_unpacklo_epi32(a, z));
+			_mm_storeu_si128((__m128i*) (dst + j + 0x0a), _mm_unpackhi_epi32(a, z));
+			a = _mm_unpackhi_epi16(h, z);
+			_mm_storeu_si128((__m128i*) (dst + j + 0x0c), _mm_unpacklo_epi32(a, z));
+			_mm_storeu_si128((__m128i*) (dst + j + 0x0e), _mm_unpackhi_epi32(a, z));
+			j += 16;
+			k += 16;
+			continue;
+		}
+
+		c = ~m & 0xff;
+		if (CTB_EXPECT0(mvbcount[c] == 0)) {
+			break;
+		}
+		a = _mm_shuffle_epi8(a, _mm_loadu_si128((const __m128i*) mvbshuffle[c]));
+		a = _mm_and_si128(a, _mm_set1_epi8(0x7f));
+		a = _mm_maddubs_epi16(_mm_set1_epi16((int16) 0x8001), a);
+		a = _mm_madd_epi16(a, _mm_set1_epi32(0x40000001));
+		_mm_storeu_si128((__m128i*) (dst + j + 0), _mm_unpacklo_epi32(a, z));
+		_mm_storeu_si128((__m128i*) (dst + j + 2), _mm_unpackhi_epi32(a, z));
+		j += mvbcount[c];
+		k += mvbconsumed[c];
+	}
+
+	total[0] = k;
+	return j;
+}
+
+#endif
+
+eintxx
+ctb_varintdecodeu32batch(const uint8* src, uintxx size, uint32* dst, uintxx count, const uint8** end)
+{
+	uintxx i;
+	uintxx j;
+	uintxx n;
+	uint64 x;
+	uint32 r;
+	eintxx e;
+	const uint8* s;
+	const uint8* p;
+#if defined(CTB_X86SIMD)
+	uintxx simd;
+#endif
+	CTB_ASSERT(src && dst);
+
+#if defined(CTB_X86SIMD)
+	simd = ctb_cpufeatures() & CTB_CPU_SSSE3;
+#endif
+
+	p = (s = src) + size;
+	for (j = 0; j < count;) {
+#if defined(CTB_X86SIMD)
+		/* the kernel stops at the integers longer than 4 bytes, those
+		 * (common in random data) go to the scalar loop directly */
+		if (simd && p - s >= 16 && count - j >= 16 && (s[0] & s[1] & s[2] & s[3] & 0x80) == 0) {
+			j += mvbdecodessse3(s, (uintxx) (p - s), dst + j, count - j, &n);
+			s += n;
+		}
+#endif
+
+		/* the integers the kernel stops at (and the tail), a few at a
+		 * time before trying it again */
+		for (i = 0; i < 32 && j < count; i++) {
+			if (CTB_EXPECT1(p - s >= VARINT_MAXSIZE32)) {
+				n = decodefast32(s, &r);
+				if (CTB_EXPECT1(n != 0)) {
+					dst[j++] = r;
+					s += n;
+					continue;
+				}
+			}
+
+			e = decodescalar(s, (uintxx) (p - s), VARINT_MAXSIZE32, &x, &n);
+			if (e == 0 && (x >> 32) != 0) {
+				e = VARINT_ERANGE;
+			}
+			if (CTB_EXPECT0(e != 0)) {
+				goto L1;
+			}
+
+			dst[j++] = (uint32) x;
+			s += n;
+		}
+	}
+	e = VARINT_OK;
+
+L1:
+	if (end)
+		end[0] = s;
+	return e;
+}
+
+eintxx
+ctb_varintdecodeu64batch(const uint8* src, uintxx size, uint64* dst, uintxx count, const uint8** end)
+{
+	uintxx i;
+	uintxx j;
+	uintxx n;
+	uint64 x;
+	eintxx e;
+	const uint8* s;
+	const uint8* p;
+#if defined(CTB_X86SIMD)
+	uintxx simd;
+#endif
+	CTB_ASSERT(src && dst);
+
+#if defined(CTB_X86SIMD)
+	simd = ctb_cpufeatures() & CTB_CPU_SSSE3;
+#endif
+
+	p = (s = src) + size;
+	for (j = 0; j < count;) {
+#if defined(CTB_X86SIMD)
+		if (simd && p - s >= 16 && count - j >= 16 && (s[0] & s[1] & s[2] & s[3] & 0x80) == 0) {
+			j += mvbdecode64ssse3(s, (uintxx) (p - s), dst + j, count - j, &n);
+			s += n;
+		}
+#endif
+
+		/* the integers the kernel stops at (and the tail), a few at a
+		 * time before trying it again */
+		for (i = 0; i < 32 && j < count; i++) {
+			if (CTB_EXPECT1(p - s >= VARINT_MAXSIZE64)) {
+				n = decodefast(s, VARINT_MAXSIZE64, &x);
+				if (CTB_EXPECT1(n != 0 && (n != VARINT_MAXSIZE64 || s[9] <= 0x01))) {
+					dst[j++] = x;
+					s += n;
+					continue;
+				}
+			}
+
+			e = decodescalar(s, (uintxx) (p - s), VARINT_MAXSIZE64, &x, &n);
+			if (e == 0 && n == VARINT_MAXSIZE64 && s[9] > 0x01) {
+				e = VARINT_ERANGE;
+			}
+			if (CTB_EXPECT0(e != 0)) {
+				goto L1;
+			}
+
+			dst[j++] = x;
+			s += n;
+		}
+	}
+	e = VARINT_OK;
+
+L1:
+	if (end)
+		end[0] = s;
+	return e;
+}
+
+
+/* ****************************************************************************
+ * Stream VByte
+ *************************************************************************** */
+
+#if defined(CTB_X86SIMD)
+
+/*
+ * Decodes groups of four integers while 16 data bytes are readable. Returns
+ * the number of groups decoded, total is updated with the data bytes used. */
+CTB_TARGET("ssse3") static uintxx
+svbdecodessse3(const uint8* ctrl, uintxx groups, const uint8* data, uintxx size, uint32* dst, uintxx* total)
+{
+	uintxx j;
+	uintxx k;
+	uint32 c;
+	__m128i a;
+
+	k = 0;
+	for (j = 0; j < groups && size - k >= 16; j++) {
+		c = ctrl[j];
+		a = _mm_loadu_si128((const __m128i*) (data + k));
+		a = _mm_shuffle_epi8(a, _mm_loadu_si128((const __m128i*) svbshuffle[c]));
+		_mm_storeu_si128((__m128i*) (dst + (j << 2)), a);
+		k += svblength[c];
+	}
+	total[0] = k;
+	return j;
+}
+
+#endif
+
+#if defined(__clang__)
+	#pragma clang diagnostic pop
+#endif
+
+uintxx
+ctb_streamvbyteencode(const uint32* src, uintxx count, uint8* dst)
+{
+	uintxx j;
+	uint32 v;
+	uint32 c;
+	uint8* ctrl;
+	uint8* data;
+	CTB_ASSERT(src && dst);
+
+	ctrl = dst;
+	data = dst + ((count + 3) >> 2);
+	for (j = 0; j < count; j++) {
+		v = src[j];
+		if ((j & 3) == 0) {
+			ctrl[j >> 2] = 0;
+		}
+
+		*data++ = (uint8) v;
+		c = 0;
+		if (v > 0xff) {
+			*data++ = (uint8) (v >> 8);
+			c = 1;
+			if (v > 0xffff) {
+				*data++ = (uint8) (v >> 16);
+				c = 2;
+				if (v > 0xffffff) {
+					*data++ = (uint8) (v >> 24);
+					c = 3;
+				}
+			}
+		}
+		ctrl[j >> 2] |= (uint8) (c << ((j & 3) << 1));
+	}
+	return (uintxx) (data - dst);
+}
+
+eintxx
+ctb_streamvbytedecode(const uint8* src, uintxx size, uint32* dst, uintxx count, const uint8** end)
+{
+	uintxx j;
+	uintxx k;
+	uintxx n;
+	uintxx l;
+	uint32 v;
+	const uint8* data;
+	CTB_ASSERT(src && dst);
+
+	n = (count + 3) >> 2;
+	if (CTB_EXPECT0(size < n)) {
+		if (end)
+			end[0] = src;
+		return VARINT_ESIZE;
+	}
+	data = src + n;
+	size = size - n;
+
+	j = 0;
+	k = 0;
+#if defined(CTB_X86SIMD)
+	if (ctb_cpufeatures() & CTB_CPU_SSSE3) {
+		j = svbdecodessse3(src, count >> 2, data, size, dst, &k) << 2;
+	}
+#endif
+
+	for (; j < count; j++) {
+		l = ((src[j >> 2] >> ((j & 3) << 1)) & 3) + 1;
+		if (CTB_EXPECT0(size - k < l)) {
+			if (end)
+				end[0] = src;
+			return VARINT_ESIZE;
+		}
+
+		v = data[k];
+		switch (l) {
+			case 4: v |= (uint32) data[k + 3] << 24;  /* fallthrough */
+			case 3: v |= (uint32) data[k + 2] << 16;  /* fallthrough */
+			case 2: v |= (uint32) data[k + 1] << 8;
+		}
+		dst[j] = v;
+		k += l;
+	}
+
+	if (end)
+		end[0] = data + k;
+	return VARINT_OK;
+}
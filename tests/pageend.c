@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2025, jpn
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * pageend.c
+ * The NUL terminated parsers must not read past the terminator into an
+ * unmapped page.
+ */
+
+#include <ctoolbox/str2int.h>
+#include <ctoolbox/str2flt.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+
+static uintxx failures;
+
+/*
+ * Copies the string (with its NUL) to the end of the first page. */
+static const uint8*
+atpageend(uint8* page, uintxx pagesize, const char* s)
+{
+	uintxx n;
+
+	n = strlen(s) + 1;
+	memcpy(page + pagesize - n, s, n);
+	return page + pagesize - n;
+}
+
+static void
+checku64(uint8* page, uintxx pagesize, const char* s, intxx base, uint64 expected)
+{
+	const uint8* src;
+	const uint8* end;
+	TToIntResult r;
+
+	src = atpageend(page, pagesize, s);
+	r = strtou64(src, &end, base);
+	if (r.error || r.value.asu64 != expected || end[0] != 0x00) {
+		printf("strtou64(\"%s\", %d): wrong result\n", s, (int) base);
+		failures++;
+	}
+
+	r = strtoi64(src, &end, base);
+	if (r.error || r.value.asi64 != (int64) expected || end[0] != 0x00) {
+		printf("strtoi64(\"%s\", %d): wrong result\n", s, (int) base);
+		failures++;
+	}
+
+	if (expected <= 0xffffffffu) {
+		r = strtou32(src, &end, base);
+		if (r.error || r.value.asu32 != (uint32) expected || end[0] != 0x00) {
+			printf("strtou32(\"%s\", %d): wrong result\n", s, (int) base);
+			failures++;
+		}
+	}
+	if (expected <= 0x7fffffffu) {
+		r = strtoi32(src, &end, base);
+		if (r.error || r.value.asi32 != (int32) expected || end[0] != 0x00) {
+			printf("strtoi32(\"%s\", %d): wrong result\n", s, (int) base);
+			failures++;
+		}
+	}
+}
+
+static void
+checkf64(uint8* page, uintxx pagesize, const char* s, flt64 expected)
+{
+	const uint8* src;
+	const uint8* end;
+	TToFltResult r;
+
+	src = atpageend(page, pagesize, s);
+	r = str2flt64(src, &end);
+	if (r.error || r.value.asf64 != expected || end[0] != 0x00) {
+		printf("str2flt64(\"%s\"): wrong result\n", s);
+		failures++;
+	}
+}
+
+
+int
+main(void)
+{
+	uint8* page;
+	uintxx pagesize;
+
+	pagesize = (uintxx) sysconf(_SC_PAGESIZE);
+	page = mmap(NULL, pagesize * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (page == MAP_FAILED) {
+		puts("mmap failed");
+		return 1;
+	}
+	if (mprotect(page + pagesize, pagesize, PROT_NONE)) {
+		puts("mprotect failed");
+		return 1;
+	}
+
+	checku64(page, pagesize, "ff", 16, 0xff);
+	checku64(page, pagesize, "0xff", 0, 0xff);
+	checku64(page, pagesize, "7fffffffffff", 16, 0x7fffffffffffull);
+	checku64(page, pagesize, "123456789abcdef", 16, 0x123456789abcdefull);
+	checku64(page, pagesize, "101", 2, 5);
+	checku64(page, pagesize, "1111111111111111111", 2, 0x7ffff);
+	checku64(page, pagesize, "777", 8, 0x1ff);
+	checku64(page, pagesize, "3210", 4, 0xe4);
+	checku64(page, pagesize, "12", 10, 12);
+
+	checkf64(page, pagesize, "1", 1.0);
+	checkf64(page, pagesize, "1.5", 1.5);
+	checkf64(page, pagesize, "123456789.125", 123456789.125);
+	checkf64(page, pagesize, "0.000123", 0.000123);
+
+	munmap(page, pagesize * 2);
+	if (failures) {
+		printf("%u failures\n", (unsigned) failures);
+		return 1;
+	}
+	return 0;
+}